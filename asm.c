@@ -0,0 +1,356 @@
+#include "litecc.h"
+
+// x86-64 machine code encoder.
+//
+// Encodes the instruction lists built by the code generator directly
+// into machine code, so that object files can be written without
+// going through an external assembler. All operands are 64 bits
+// wide. References to symbols are left as relocations for the
+// linker; references to local labels are resolved here.
+//
+// Jumps are encoded in their short, 8-bit displacement form when
+// the target is close enough. Since growing one jump can push other
+// targets out of range, jump sizes are chosen iteratively: all jumps
+// start short and are lengthened until every displacement fits.
+
+// Functions may be assembled on several threads at once, each into
+// its own object.
+static _Thread_local Object* obj;
+static _Thread_local Buf*    code;  // Encoded non-jump instructions of a function
+static _Thread_local int     cur_inst;
+
+// Relocations are first recorded against the instruction that
+// contains them and are rebased once the layout is final.
+typedef struct {
+  int  inst;
+  long offset;  // Offset in `code`
+  int  sym;
+  int  type;
+  long addend;
+} PendingReloc;
+
+static _Thread_local PendingReloc* pending;
+static _Thread_local int npending;
+static _Thread_local int pending_cap;
+
+static bool is_imm8(long val) {
+  return val == (signed char)val;
+}
+
+static void put8(int val) {
+  buf_putc(code, val);
+}
+
+static void put32(long val) {
+  for (int i = 0; i < 4; i++)
+    put8(val >> (i * 8));
+}
+
+static void put64(long val) {
+  for (int i = 0; i < 8; i++)
+    put8(val >> (i * 8));
+}
+
+static void add_reloc(int sym, int type, long addend) {
+  if (npending == pending_cap) {
+    pending_cap = pending_cap ? pending_cap * 2 : 64;
+    pending = realloc(pending, pending_cap * sizeof(PendingReloc));
+  }
+  pending[npending++] = (PendingReloc){
+    .inst = cur_inst, .offset = code->len, .sym = sym, .type = type,
+    .addend = addend,
+  };
+}
+
+// Emits a ModRM byte, plus a SIB byte and displacement if `rm` is a
+// memory operand. `imm_size` is the size of any immediate that
+// follows, which RIP-relative displacements must account for.
+static void modrm(int reg, Operand* rm, int imm_size) {
+  reg &= 7;
+  if (rm->kind == OPR_REG) {
+    put8(0xc0 | reg << 3 | (rm->reg & 7));
+    return;
+  }
+
+  if (rm->reg == RIP) {
+    put8(reg << 3 | 5);
+    add_reloc(rm->sym, R_X86_64_PC32, rm->val - 4 - imm_size);
+    put32(0);
+    return;
+  }
+
+  // rbp and r13 have no displacement-free form, and rsp and r12 as a
+  // base need a SIB byte.
+  int base = rm->reg & 7;
+  long disp = rm->val;
+  int mod = (disp == 0 && base != 5) ? 0 : is_imm8(disp) ? 1 : 2;
+  put8(mod << 6 | reg << 3 | base);
+  if (base == 4)
+    put8(0x24);
+  if (mod == 1)
+    put8(disp);
+  else if (mod == 2)
+    put32(disp);
+}
+
+// Emits a REX.W-prefixed instruction with a ModRM operand. Two-byte
+// opcodes are given as 0x0fXX.
+static void op_rm(int opcode, int reg, Operand* rm, int imm_size) {
+  int base = rm->kind == OPR_REG || rm->reg != RIP ? rm->reg : 0;
+  put8(0x48 | (reg >> 3 & 1) << 2 | (base >> 3 & 1));
+  if (opcode > 0xff)
+    put8(opcode >> 8);
+  put8(opcode & 0xff);
+  modrm(reg, rm, imm_size);
+}
+
+// Emits an instruction that takes an immediate operand, using the
+// sign-extended 8-bit form if the value fits.
+static void op_rm_imm(int op8, int op32, int reg, Operand* rm, long imm) {
+  if (is_imm8(imm)) {
+    op_rm(op8, reg, rm, 1);
+    put8(imm);
+  } else {
+    op_rm(op32, reg, rm, 4);
+    put32(imm);
+  }
+}
+
+// Encodes add, sub, and and cmp. `ext` is the opcode extension of
+// the immediate form and `op` the opcode of the `r/m, reg` form.
+static void encode_alu(Inst* in, int ext, int op) {
+  if (in->b.kind == OPR_IMM)
+    op_rm_imm(0x83, 0x81, ext, &in->a, in->b.val);
+  else if (in->b.kind == OPR_REG)
+    op_rm(op, in->b.reg, &in->a, 0);
+  else
+    op_rm(op + 2, in->a.reg, &in->b, 0);
+}
+
+static void encode_mov(Inst* in) {
+  Operand* a = &in->a;
+  Operand* b = &in->b;
+
+  if (b->kind == OPR_IMM) {
+    if (is_imm32(b->val)) {
+      op_rm(0xc7, 0, a, 4);
+      put32(b->val);
+    } else {
+      put8(0x48 | (a->reg >> 3));
+      put8(0xb8 | (a->reg & 7));
+      put64(b->val);
+    }
+    return;
+  }
+
+  if (b->kind == OPR_REG)
+    op_rm(0x89, b->reg, a, 0);
+  else
+    op_rm(0x8b, a->reg, b, 0);
+}
+
+static void push_pop(int opcode, Reg reg) {
+  if (reg >= R8)
+    put8(0x41);
+  put8(opcode | (reg & 7));
+}
+
+static int cc_code(CondCode cc) {
+  switch (cc) {
+    case CC_E:  return 0x4;
+    case CC_NE: return 0x5;
+    case CC_L:  return 0xc;
+    case CC_GE: return 0xd;
+    case CC_LE: return 0xe;
+    case CC_G:  return 0xf;
+  }
+  error("internal error: unknown condition code");
+}
+
+static void encode(Inst* in) {
+  Operand al = op_reg(RAX);
+
+  switch (in->kind) {
+    case I_NOP:
+    case I_LABEL:
+      return;
+    case I_MOV:
+      encode_mov(in);
+      return;
+    case I_LEA:
+      op_rm(0x8d, in->a.reg, &in->b, 0);
+      return;
+    case I_ADD:
+      encode_alu(in, 0, 0x01);
+      return;
+    case I_SUB:
+      encode_alu(in, 5, 0x29);
+      return;
+    case I_AND:
+      encode_alu(in, 4, 0x21);
+      return;
+    case I_CMP:
+      encode_alu(in, 7, 0x39);
+      return;
+    case I_IMUL:
+      if (in->c.kind == OPR_IMM)
+        op_rm_imm(0x6b, 0x69, in->a.reg, &in->b, in->c.val);
+      else
+        op_rm(0x0faf, in->a.reg, &in->b, 0);
+      return;
+    case I_IDIV:
+      op_rm(0xf7, 7, &in->a, 0);
+      return;
+    case I_NEG:
+      op_rm(0xf7, 3, &in->a, 0);
+      return;
+    case I_CQO:
+      put8(0x48);
+      put8(0x99);
+      return;
+    case I_SETCC:
+      put8(0x0f);
+      put8(0x90 | cc_code(in->cc));
+      put8(0xc0);
+      return;
+    case I_MOVZB:
+      op_rm(0x0fb6, in->a.reg, &al, 0);
+      return;
+    case I_PUSH:
+      if (in->a.kind == OPR_REG) {
+        push_pop(0x50, in->a.reg);
+      } else if (in->a.kind == OPR_IMM) {
+        if (is_imm8(in->a.val)) {
+          put8(0x6a);
+          put8(in->a.val);
+        } else {
+          put8(0x68);
+          put32(in->a.val);
+        }
+      } else {
+        op_rm(0xff, 6, &in->a, 0);
+      }
+      return;
+    case I_POP:
+      push_pop(0x58, in->a.reg);
+      return;
+    case I_CALL:
+      put8(0xe8);
+      add_reloc(in->a.sym, R_X86_64_PLT32, -4);
+      put32(0);
+      return;
+    case I_RET:
+      put8(0xc3);
+      return;
+  }
+  error("internal error: cannot encode instruction");
+}
+
+static bool is_jump(Inst* in) {
+  return in->kind == I_JMP || in->kind == I_JCC;
+}
+
+static int jump_size(Inst* in, bool is_long) {
+  if (!is_long)
+    return 2;
+  return in->kind == I_JMP ? 5 : 6;
+}
+
+// Appends the machine code for the function `sym` to the object.
+void assemble(Object* o, int sym, InstList* list) {
+  obj = o;
+  int n = list->len;
+  Inst* insts = list->data;
+
+  // Encode everything but jumps, remembering where each
+  // instruction's bytes are.
+  Buf buf = {};
+  code = &buf;
+  npending = 0;
+  long* start = calloc(n + 1, sizeof(long));
+  for (int i = 0; i < n; i++) {
+    cur_inst = i;
+    start[i] = buf.len;
+    if (!is_jump(&insts[i]))
+      encode(&insts[i]);
+  }
+  start[n] = buf.len;
+
+  // Choose jump sizes and compute the final offset of each
+  // instruction.
+  bool* is_long = calloc(n, sizeof(bool));
+  long* offset = calloc(n + 1, sizeof(long));
+  HashMap labels = {};
+
+  for (bool changed = true; changed;) {
+    long off = 0;
+    for (int i = 0; i < n; i++) {
+      offset[i] = off;
+      if (insts[i].kind == I_LABEL)
+        hashmap_put(&labels, insts[i].a.val, (void*)(off + 1));
+      if (is_jump(&insts[i]))
+        off += jump_size(&insts[i], is_long[i]);
+      else
+        off += start[i + 1] - start[i];
+    }
+    offset[n] = off;
+
+    changed = false;
+    for (int i = 0; i < n; i++) {
+      if (!is_jump(&insts[i]) || is_long[i])
+        continue;
+      long target = (long)hashmap_get(&labels, insts[i].a.val) - 1;
+      if (!is_imm8(target - (offset[i] + 2))) {
+        is_long[i] = true;
+        changed = true;
+      }
+    }
+  }
+
+  // Write out the final code.
+  long base = obj->text.len;
+  Buf* text = &obj->text;
+  for (int i = 0; i < n; i++) {
+    Inst* in = &insts[i];
+    if (!is_jump(in)) {
+      buf_putn(text, buf.data + start[i], start[i + 1] - start[i]);
+      continue;
+    }
+
+    long target = (long)hashmap_get(&labels, in->a.val) - 1;
+    if (target < 0)
+      error("internal error: undefined label %ld in %s", in->a.val,
+            sym_name(sym));
+    long disp = target - (offset[i] + jump_size(in, is_long[i]));
+
+    code = text;
+    if (!is_long[i]) {
+      put8(in->kind == I_JMP ? 0xeb : 0x70 | cc_code(in->cc));
+      put8(disp);
+    } else {
+      if (in->kind == I_JMP) {
+        put8(0xe9);
+      } else {
+        put8(0x0f);
+        put8(0x80 | cc_code(in->cc));
+      }
+      put32(disp);
+    }
+  }
+
+  for (int i = 0; i < npending; i++) {
+    PendingReloc* r = &pending[i];
+    long off = base + offset[r->inst] + (r->offset - start[r->inst]);
+    obj_add_reloc(obj, off, r->sym, r->type, r->addend);
+  }
+  obj_add_func(obj, sym, base, text->len - base);
+
+  free(pending);
+  pending = NULL;
+  pending_cap = 0;
+  free(buf.data);
+  free(start);
+  free(is_long);
+  free(offset);
+  free(labels.buckets);
+}
@@ -0,0 +1,124 @@
+#!/bin/bash
+# Synthetic program generator.
+#
+# Writes a valid litecc program of the given shape to stdout:
+#
+#   funcs     many small functions calling each other
+#   locals    functions with thousands of local variables
+#   nesting   deeply nested expressions
+#   stmts     one function with a very long statement list
+#   globals   large global arrays
+#   ptrarith  heavy pointer arithmetic and indexing
+#
+# The optional second argument scales the size of the program
+# (default 1). Every program's main returns 0.
+#
+#   bench/gen.sh locals 2 > big.c
+
+shape=$1
+scale=${2:-1}
+
+case "$shape" in
+funcs|locals|nesting|stmts|globals|ptrarith) ;;
+*)
+  echo "usage: $0 funcs|locals|nesting|stmts|globals|ptrarith [scale]" >&2
+  exit 1
+  ;;
+esac
+
+awk -v shape="$shape" -v scale="$scale" '
+function funcs(n,   i) {
+  printf "int f0(int a, int b) { return a + b; }\n"
+  for (i = 1; i < n; i++) {
+    printf "int f%d(int a, int b) {\n", i
+    printf "  int x; x = f%d(b, a / 7) + %d;\n", i - 1, i % 13
+    printf "  if (x > 1000) x = x - 1000;\n"
+    printf "  return x;\n"
+    printf "}\n"
+  }
+  printf "int main() { f%d(1, 2); return 0; }\n", n - 1
+}
+
+function locals(nfn, nvar,   i, j) {
+  for (i = 0; i < nfn; i++) {
+    printf "int f%d(int a) {\n", i
+    for (j = 0; j < nvar; j++)
+      printf "  int v%d; v%d = a + %d;\n", j, j, j
+    # Refer to early variables after many others are declared.
+    printf "  int s; s = 0;\n"
+    for (j = 0; j < nvar; j += 7)
+      printf "  s = s + v%d - v%d;\n", j, nvar - 1 - j
+    printf "  return s;\n}\n"
+  }
+  printf "int main() { f0(3); return 0; }\n"
+}
+
+# Returns an expression nested `depth` parentheses deep.
+function nest(depth, seed,   s, i) {
+  s = "a"
+  for (i = 0; i < depth; i++) {
+    if (i % 4 == 0)      s = "(" s " + " (seed + i) % 10 ")"
+    else if (i % 4 == 1) s = "(b * " s ")"
+    else if (i % 4 == 2) s = "(" s " - b)"
+    else                 s = "(" s " / 2)"
+  }
+  return s
+}
+
+function nesting(nfn, depth,   i) {
+  for (i = 0; i < nfn; i++) {
+    printf "int f%d(int a, int b) {\n", i
+    printf "  return %s;\n", nest(depth, i)
+    printf "}\n"
+  }
+  printf "int main() { f0(1, 1); return 0; }\n"
+}
+
+function stmts(n,   i) {
+  printf "int main() {\n"
+  printf "  int x; int y; int i; x = 0; y = 1;\n"
+  for (i = 0; i < n; i++) {
+    if (i % 5 == 0)      printf "  x = x + y * %d;\n", i % 9
+    else if (i % 5 == 1) printf "  if (x > %d) x = x - %d; else y = y + 1;\n", i, i % 50
+    else if (i % 5 == 2) printf "  for (i = 0; i < 3; i = i + 1) y = y + i;\n"
+    else if (i % 5 == 3) printf "  while (y > 100) y = y - 100;\n"
+    else                 printf "  { int t; t = x; x = y; y = t; }\n"
+  }
+  printf "  return 0;\n}\n"
+}
+
+function globals(narr, len,   i) {
+  for (i = 0; i < narr; i++)
+    printf "int g%d[%d];\n", i, len
+  printf "int m[%d][%d];\n", len, len
+  for (i = 0; i < narr; i++) {
+    printf "int f%d(int n) {\n", i
+    printf "  int i; int s; s = 0;\n"
+    printf "  for (i = 0; i < n; i = i + 1) g%d[i] = i * %d;\n", i, i % 5
+    printf "  for (i = 0; i < n; i = i + 1) s = s + g%d[i] - m[i / 16][i];\n", i
+    printf "  return s;\n}\n"
+  }
+  printf "int main() { f0(10); return 0; }\n"
+}
+
+function ptrarith(nfn,   i) {
+  printf "int buf[64];\n"
+  for (i = 0; i < nfn; i++) {
+    printf "int f%d(int *p, int n) {\n", i
+    printf "  int *q; int *r; int i; q = p + n - 1; r = &p[2];\n"
+    printf "  for (i = 0; i < n / 2; i = i + 1) { *(p + i) = *(q - i) + i; q[-i] = r[i / 4]; }\n"
+    printf "  *(r + 1) = (q - p) + (r - p) * %d;\n", i % 11
+    printf "  return *(p + (q - r)) + *&*(&p[1] + 1) + sizeof(p) + sizeof(*p);\n"
+    printf "}\n"
+  }
+  printf "int main() { f0(buf, 16); return 0; }\n"
+}
+
+BEGIN {
+  if (shape == "funcs")         funcs(20000 * scale)
+  else if (shape == "locals")   locals(40 * scale, 2000)
+  else if (shape == "nesting")  nesting(200 * scale, 800)
+  else if (shape == "stmts")    stmts(50000 * scale)
+  else if (shape == "globals")  globals(5000 * scale, 64)
+  else if (shape == "ptrarith") ptrarith(8000 * scale)
+}'
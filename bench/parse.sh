@@ -0,0 +1,51 @@
+#!/bin/bash
+# Parser microbenchmark.
+#
+# Generates a large, expression-heavy program and measures how fast
+# each given litecc binary parses it (-fsyntax-only, so code
+# generation is not included). Pass several binaries to compare
+# builds, e.g. before and after a change:
+#
+#   bench/parse.sh ./litecc.old ./litecc
+#
+# FUNCS and RUNS in the environment control the input size and the
+# number of timed runs per binary; the best run is reported.
+
+FUNCS=${FUNCS:-20000}
+RUNS=${RUNS:-5}
+input=$(mktemp /tmp/litecc-bench-XXXXXX.c)
+trap 'rm -f "$input"' EXIT
+
+[ $# -gt 0 ] || set -- ./litecc
+
+awk -v n="$FUNCS" 'BEGIN {
+  for (i = 0; i < n; i++) {
+    printf "int f%d(int a, int b, int c) {\n", i
+    printf "  int x; int y; int *p; p=&x;\n"
+    printf "  x = a*b + (a-b)*(c+%d) / (b+1) - -c + *p;\n", i
+    printf "  y = (x*x - a*(b - c*(a + b*%d))) / (1 + (a==b) + (b!=c));\n", i
+    printf "  if ((x <= y) == (a > b) != (c >= a) + (a < c*2)) y = y - x*%d;\n", i % 97
+    printf "  while (x < y + a*b - c) x = x + (y - x) / 2 + 1;\n"
+    printf "  return x + y*2 - (a + b + c) * (x - y) / (a*a + b*b + c*c + 1);\n"
+    printf "}\n"
+  }
+  printf "int main() { return f0(1, 2, 3); }\n"
+}' > "$input"
+
+bytes=$(wc -c < "$input")
+lines=$(wc -l < "$input")
+echo "input: $lines lines, $bytes bytes"
+
+for cc in "$@"; do
+  best=
+  for ((r = 0; r < RUNS; r++)); do
+    start=$(date +%s%N)
+    "$cc" -fsyntax-only "$input" || exit 1
+    t=$(( $(date +%s%N) - start ))
+    [ -z "$best" ] || [ "$t" -lt "$best" ] && best=$t
+  done
+  awk -v cc="$cc" -v t="$best" -v b="$bytes" -v l="$lines" 'BEGIN {
+    printf "%-24s %8.2f ms  %8.1f MB/s  %10.0f lines/s\n",
+      cc, t / 1e6, b / (t / 1e3), l / (t / 1e9)
+  }'
+done
@@ -0,0 +1,80 @@
+#!/bin/bash
+# Compile-throughput benchmark.
+#
+# Generates a program of each shape with bench/gen.sh, times litecc
+# compiling it to assembly and reports lines and tokens per second.
+# The results are checked against bench/baseline; a shape that is
+# more than TOLERANCE times slower than its baseline fails the run.
+# This is meant to catch asymptotic regressions, which show up as
+# large slowdowns on the bigger inputs, rather than small ones.
+#
+#   bench/run.sh                  # check ./litecc
+#   bench/run.sh --update         # rewrite the baseline
+#   bench/run.sh ./litecc.other
+#
+# SCALE, RUNS and TOLERANCE in the environment control the input
+# size, the number of timed runs per shape (the best run is used)
+# and the allowed slowdown.
+
+SCALE=${SCALE:-1}
+RUNS=${RUNS:-3}
+TOLERANCE=${TOLERANCE:-2}
+dir=$(dirname "$0")
+baseline=$dir/baseline
+
+update=
+if [ "$1" = --update ]; then
+  update=1
+  shift
+fi
+cc=${1:-./litecc}
+
+input=$(mktemp /tmp/litecc-bench-XXXXXX.c)
+trap 'rm -f "$input"' EXIT
+
+[ -n "$update" ] && echo "# shape  tokens/s  (SCALE=$SCALE)" > "$baseline"
+
+printf "%-10s %8s %9s %10s %12s %12s %10s\n" \
+  shape lines tokens ms lines/s tokens/s baseline
+status=0
+
+for shape in funcs locals nesting stmts globals ptrarith; do
+  "$dir/gen.sh" $shape "$SCALE" > "$input"
+  lines=$(wc -l < "$input")
+  tokens=$("$cc" --stats=- -fsyntax-only "$input" |
+           sed -n 's/.*"tokens": \([0-9]*\).*/\1/p')
+
+  # The generated program must also run.
+  "$cc" --run "$input" || { echo "$shape: program failed"; exit 1; }
+
+  best=
+  for ((r = 0; r < RUNS; r++)); do
+    start=$(date +%s%N)
+    "$cc" -S -o /dev/null "$input" || exit 1
+    t=$(( $(date +%s%N) - start ))
+    [ -z "$best" ] || [ "$t" -lt "$best" ] && best=$t
+  done
+  rate=$(( tokens * 1000000000 / best ))
+
+  if [ -n "$update" ]; then
+    echo "$shape $rate" >> "$baseline"
+    base=$rate
+  else
+    base=$(awk -v s=$shape '$1 == s { print $2 }' "$baseline" 2>/dev/null)
+  fi
+
+  verdict=
+  if [ -z "$base" ]; then
+    verdict="(no baseline)"
+  elif [ $(( rate * TOLERANCE )) -lt "$base" ]; then
+    verdict="REGRESSION"
+    status=1
+  fi
+
+  awk -v s=$shape -v l=$lines -v k=$tokens -v t=$best -v b="$base" -v v="$verdict" 'BEGIN {
+    printf "%-10s %8d %9d %10.1f %12.0f %12.0f %10s %s\n",
+      s, l, k, t / 1e6, l / (t / 1e9), k / (t / 1e9), b, v
+  }'
+done
+
+exit $status
@@ -0,0 +1,202 @@
+#include "litecc.h"
+
+// On-disk cache of generated assembly, one entry per function.
+//
+// An entry is keyed by a hash of the function's tokens, the types of
+// the global variables it may refer to, the options that affect code
+// generation and the compiler executable itself, so a rebuilt
+// compiler never reuses stale entries. The value is the function's
+// assembly text, which does not depend on anything else since labels
+// are numbered per function.
+//
+// Entries are files named after the key in the cache directory. They
+// are written to a temporary file and renamed into place, so
+// concurrent compilers never see a partial entry. A hit updates the
+// entry's modification time, and when the directory grows beyond
+// its size limit the least recently used entries are removed.
+
+bool cache_enabled;
+
+static char*       cache_dir;
+static long        cache_max_bytes;
+static CacheKey    base_key;  // Compiler and options
+static atomic_long hits;
+static atomic_long misses;
+static atomic_long stores;
+static atomic_long evicted;
+static atomic_int  tmpseq;
+
+#define FNV64_OFFSET 14695981039346656037ull
+#define FNV64_PRIME  1099511628211ull
+
+// Two independent 64-bit hashes make a 128-bit key.
+void hash_bytes(CacheKey* key, void* p, size_t n) {
+  unsigned char* s = p;
+  for (size_t i = 0; i < n; i++) {
+    key->h1 = (key->h1 ^ s[i]) * FNV64_PRIME;
+    key->h2 = ((key->h2 << 5 | key->h2 >> 59) ^ s[i]) * 0x9e3779b97f4a7c15ull;
+  }
+}
+
+void hash_long(CacheKey* key, long val) {
+  hash_bytes(key, &val, sizeof(val));
+}
+
+// Returns a key that covers the compiler and its options, to which
+// the function's contents are to be added.
+CacheKey cache_key(void) {
+  return base_key;
+}
+
+static void make_dir(char* path) {
+  char* buf = strdup(path);
+  for (char* p = buf + 1;; p++) {
+    if (*p != '/' && *p != '\0')
+      continue;
+    char c = *p;
+    *p = '\0';
+    if (mkdir(buf, 0777) == -1 && errno != EEXIST)
+      error("cannot create cache directory %s: %s", buf, strerror(errno));
+    if (!c)
+      break;
+    *p = c;
+  }
+  free(buf);
+}
+
+// Enables the cache in directory `dir`, limited to `max_bytes`.
+void cache_init(char* dir, long max_bytes) {
+  cache_dir = dir;
+  cache_max_bytes = max_bytes;
+  make_dir(dir);
+
+  base_key = (CacheKey){ FNV64_OFFSET, FNV64_OFFSET };
+  int fd = open("/proc/self/exe", O_RDONLY);
+  if (fd == -1)
+    error("cannot open /proc/self/exe: %s", strerror(errno));
+  char buf[65536];
+  for (ssize_t n; (n = read(fd, buf, sizeof(buf))) > 0;)
+    hash_bytes(&base_key, buf, n);
+  close(fd);
+
+  hash_long(&base_key, opt_O);
+  hash_long(&base_key, opt_peephole);
+  cache_enabled = true;
+}
+
+static char* entry_path(CacheKey* key) {
+  char* path = malloc(strlen(cache_dir) + 40);
+  sprintf(path, "%s/%016lx%016lx", cache_dir, (unsigned long)key->h1,
+          (unsigned long)key->h2);
+  return path;
+}
+
+// Returns the cached text for `key`, or NULL if there is none. The
+// text lives until region_free().
+char* cache_get(CacheKey* key) {
+  char* path = entry_path(key);
+  FILE* fp = fopen(path, "r");
+  struct stat st;
+  if (!fp || fstat(fileno(fp), &st) == -1) {
+    if (fp)
+      fclose(fp);
+    free(path);
+    misses++;
+    return NULL;
+  }
+
+  char* text = region_alloc(MEM_FUNCS, st.st_size + 1);
+  text[fread(text, 1, st.st_size, fp)] = '\0';
+  fclose(fp);
+
+  // Mark the entry as recently used.
+  utimensat(AT_FDCWD, path, NULL, 0);
+  free(path);
+  hits++;
+  return text;
+}
+
+// Stores `len` bytes of `text` under `key`. Failing to write the
+// cache is not an error.
+void cache_put(CacheKey* key, char* text, size_t len) {
+  char* path = entry_path(key);
+  char* tmp = malloc(strlen(cache_dir) + 64);
+  sprintf(tmp, "%s/tmp.%d.%d", cache_dir, getpid(), tmpseq++);
+
+  FILE* fp = fopen(tmp, "w");
+  if (fp) {
+    bool ok = fwrite(text, 1, len, fp) == len;
+    if (fclose(fp) == 0 && ok && rename(tmp, path) == 0)
+      stores++;
+    else
+      unlink(tmp);
+  }
+  free(tmp);
+  free(path);
+}
+
+typedef struct {
+  char*           name;
+  long            size;   // Bytes on disk
+  struct timespec mtime;
+} Entry;
+
+static int by_mtime(const void* x, const void* y) {
+  struct timespec* a = &((Entry*)x)->mtime;
+  struct timespec* b = &((Entry*)y)->mtime;
+  if (a->tv_sec != b->tv_sec)
+    return a->tv_sec < b->tv_sec ? -1 : 1;
+  return a->tv_nsec < b->tv_nsec ? -1 : a->tv_nsec > b->tv_nsec;
+}
+
+// Removes the least recently used entries until the cache fits in
+// its size limit. Only needed if entries were added.
+void cache_evict(void) {
+  if (!cache_enabled || stores == 0)
+    return;
+
+  DIR* dir = opendir(cache_dir);
+  if (!dir)
+    return;
+
+  Entry* entries = NULL;
+  int n = 0;
+  int cap = 0;
+  long total = 0;
+  int dfd = dirfd(dir);
+
+  for (struct dirent* de; (de = readdir(dir)) != NULL;) {
+    struct stat st;
+    if (strlen(de->d_name) != 32 ||
+        fstatat(dfd, de->d_name, &st, 0) == -1 || !S_ISREG(st.st_mode))
+      continue;
+    if (n == cap) {
+      cap = cap ? cap * 2 : 256;
+      entries = realloc(entries, cap * sizeof(Entry));
+    }
+    // Count the disk space used, not just the file size.
+    long size = st.st_blocks * 512;
+    entries[n++] = (Entry){ strdup(de->d_name), size, st.st_mtim };
+    total += size;
+  }
+
+  if (total > cache_max_bytes) {
+    qsort(entries, n, sizeof(Entry), by_mtime);
+    for (int i = 0; i < n && total > cache_max_bytes; i++) {
+      if (unlinkat(dfd, entries[i].name, 0) == 0) {
+        total -= entries[i].size;
+        evicted++;
+      }
+    }
+  }
+
+  for (int i = 0; i < n; i++)
+    free(entries[i].name);
+  free(entries);
+  closedir(dir);
+}
+
+void print_cache_stats(FILE* out) {
+  fprintf(out, "cache: %ld hits, %ld misses, %ld stored, %ld evicted\n",
+          (long)hits, (long)misses, (long)stores, (long)evicted);
+}
@@ -1,289 +1,580 @@
 #include "litecc.h"
 
-static char *argreg[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+// x86-64 backend.
+//
+// Translates the three-address code produced by ir.c into x86
+// instructions. Virtual registers are first assigned to machine
+// registers by linear-scan allocation; those that do not fit are
+// given stack slots in the frame. Since a virtual register never
+// outlives its basic block, its live interval is simply the range
+// from its definition to its last use in layout order.
 
-static int labelseq = 1;
-static char* funcname;
+static Reg argreg[] = {RDI, RSI, RDX, RCX, R8, R9};
 
-static void gen(Node* node);
+// Allocatable registers. r10 and r11 are caller-saved and are only
+// given to values that do not live across a call; the others are
+// callee-saved and are saved in the prologue if used. rax, rdx and
+// rdi are used as scratch within a single instruction.
+static Reg regs[] = {R10, R11, RBX, R12, R13, R14, R15};
 
-// Pushes the given node's address to the stack
-static void gen_addr(Node* node) {
-  switch (node->kind) {
-  case ND_VAR: {
-    Var* var = node->var;
-    if (var->is_local) {
-      printf("  lea rax, [rbp-%d]\n", var->offset);
-      printf("  push rax\n");
-    } else {
-      printf("  push offset %s\n", var->name);
+#define NUM_REGS (int)(sizeof(regs) / sizeof(*regs))
+
+static bool is_callee_saved(Reg reg) {
+  return reg != R10 && reg != R11;
+}
+
+// Functions are generated in parallel (see gen_functions()), so the
+// state of the function being generated is per thread.
+static _Thread_local int return_label;
+static _Thread_local InstList* insts;
+
+static Inst* emit(InstKind kind, Operand a, Operand b) {
+  return inst_add(insts, kind, a, b);
+}
+
+static Inst* emit0(InstKind kind) {
+  return emit(kind, (Operand){}, (Operand){});
+}
+
+static Inst* emit1(InstKind kind, Operand a) {
+  return emit(kind, a, (Operand){});
+}
+
+static void emit_label(int label) {
+  emit1(I_LABEL, op_label(label));
+}
+
+static void emit_jcc(CondCode cc, int label) {
+  emit1(I_JCC, op_label(label))->cc = cc;
+}
+
+//
+// Register allocation
+//
+
+typedef struct {
+  int start;  // Position of the definition
+  int end;    // Position of the last use
+  int hint;   // Virtual register whose machine register to prefer
+} Interval;
+
+static _Thread_local Operand* locs;     // Location of each virtual register
+static _Thread_local int      nslots;   // Number of spill slots
+static _Thread_local int      frame_size;
+static _Thread_local uint32_t used_regs;
+
+static Interval* compute_intervals(Function* fn, int** calls, int* ncalls) {
+  Interval* iv = calloc(fn->nvregs + 1, sizeof(Interval));
+  int ncall = 0;
+  int cap = 16;
+  *calls = malloc(cap * sizeof(int));
+
+  int pos = 0;
+  for (BasicBlock* bb = fn->bbs; bb; bb = bb->next) {
+    for (IrInst* in = bb->insts; in; in = in->next, pos++) {
+      if (in->a)
+        iv[in->a].end = pos;
+      if (in->b)
+        iv[in->b].end = pos;
+      for (int i = 0; i < in->nargs; i++)
+        iv[in->args[i]].end = pos;
+
+      if (in->op == IR_CALL) {
+        if (ncall == cap)
+          *calls = realloc(*calls, (cap *= 2) * sizeof(int));
+        (*calls)[ncall++] = pos;
+      }
+
+      if (in->d) {
+        iv[in->d].start = iv[in->d].end = pos;
+        // Two-address instructions are cheapest when the result
+        // shares a register with the left operand.
+        iv[in->d].hint = in->a;
+      }
     }
-    return;
   }
-  case ND_DEREF:
-    gen(node->lhs);
-    return;
+  *ncalls = ncall;
+  return iv;
+}
+
+// Returns true if a call happens strictly inside the interval.
+static bool crosses_call(Interval* iv, int* calls, int ncalls) {
+  // Calls are sorted by position, so binary-search the first call
+  // after the start.
+  int lo = 0, hi = ncalls;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (calls[mid] <= iv->start)
+      lo = mid + 1;
+    else
+      hi = mid;
   }
+  return lo < ncalls && calls[lo] < iv->end;
+}
 
-  error_tok(node->tok, "not an lvalue");
+static Operand new_slot(void) {
+  return op_mem(RBP, -(frame_size + 8 * ++nslots));
 }
 
-static void gen_lval(Node* node) {
-  if (node->ty->kind == TY_ARRAY)
-    error_tok(node->tok, "not an lvalue");
-  gen_addr(node);
+static void allocate_registers(Function* fn) {
+  int* calls;
+  int ncalls;
+  Interval* iv = compute_intervals(fn, &calls, &ncalls);
+
+  locs = calloc(fn->nvregs + 1, sizeof(Operand));
+  int owner[NUM_REGS] = {};  // Virtual register held by each register
+  nslots = 0;
+  used_regs = 0;
+
+  // Virtual registers are numbered in order of definition, which is
+  // also the order of their intervals' start positions.
+  for (int v = 1; v <= fn->nvregs; v++) {
+    Interval* cur = &iv[v];
+
+    // Free registers whose intervals have ended. A register may be
+    // reused by an instruction that reads its last value.
+    for (int i = 0; i < NUM_REGS; i++)
+      if (owner[i] && iv[owner[i]].end <= cur->start)
+        owner[i] = 0;
+
+    bool callee_only = crosses_call(cur, calls, ncalls);
+    int reg = -1;
+
+    for (int i = 0; i < NUM_REGS; i++) {
+      if (owner[i] || (callee_only && !is_callee_saved(regs[i])))
+        continue;
+      if (cur->hint && locs[cur->hint].kind == OPR_REG &&
+          locs[cur->hint].reg == regs[i]) {
+        reg = i;
+        break;
+      }
+      if (reg == -1)
+        reg = i;
+    }
+
+    // No register is free. Spill whichever of the candidates lives
+    // the longest.
+    if (reg == -1) {
+      int victim = -1;
+      for (int i = 0; i < NUM_REGS; i++) {
+        if (callee_only && !is_callee_saved(regs[i]))
+          continue;
+        if (victim == -1 || iv[owner[i]].end > iv[owner[victim]].end)
+          victim = i;
+      }
+      if (victim == -1 || iv[owner[victim]].end <= cur->end) {
+        locs[v] = new_slot();
+        continue;
+      }
+      locs[owner[victim]] = new_slot();
+      reg = victim;
+    }
+
+    owner[reg] = v;
+    locs[v] = op_reg(regs[reg]);
+    used_regs |= 1u << regs[reg];
+  }
+
+  free(iv);
+  free(calls);
 }
 
-static void load(void) {
-  printf("  pop rax\n");
-  printf("  mov rax, [rax]\n");
-  printf("  push rax\n");
+//
+// Instruction selection
+//
+
+static bool same(Operand* x, Operand* y) {
+  return x->kind == y->kind && x->reg == y->reg && x->val == y->val;
 }
 
-static void store(void) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
-  printf("  mov [rax], rdi\n");
-  printf("  push rdi\n");
+static bool is_reg(Operand* op) {
+  return op->kind == OPR_REG;
 }
 
-// Generate code for a given node.
-static void gen(Node* node) {
-  if (node == NULL) {
+static void emit_mov(Operand dst, Operand src) {
+  if (same(&dst, &src))
     return;
+  // There is no memory-to-memory move, and only registers take a
+  // 64-bit immediate.
+  if (dst.kind == OPR_MEM &&
+      (src.kind == OPR_MEM || (src.kind == OPR_IMM && !is_imm32(src.val)))) {
+    emit(I_MOV, op_reg(RAX), src);
+    src = op_reg(RAX);
   }
+  emit(I_MOV, dst, src);
+}
+
+// Returns `op` as a register, loading it into `scratch` if needed.
+static Operand in_reg(Operand op, Reg scratch) {
+  if (is_reg(&op))
+    return op;
+  emit(I_MOV, op_reg(scratch), op);
+  return op_reg(scratch);
+}
+
+// Returns the register to compute the result of `in` into.
+static Operand result_reg(IrInst* in) {
+  return is_reg(&locs[in->d]) ? locs[in->d] : op_reg(RAX);
+}
+
+static Operand rhs_operand(IrInst* in) {
+  return in->b ? locs[in->b] : op_imm(in->imm);
+}
 
-  switch (node->kind) {
-    case ND_NULL:
+static Operand var_operand(Var* var, long offset) {
+  if (var->is_local)
+    return op_mem(RBP, offset - var->offset);
+  return op_rip(var->sym, offset);
+}
+
+static int bb_label(BasicBlock* bb) {
+  return bb->id + 1;
+}
+
+static void gen_arith(IrInst* in) {
+  Operand a = locs[in->a];
+  Operand b = rhs_operand(in);
+  Operand d = result_reg(in);
+
+  // Computing into the right-hand side's register would overwrite
+  // it before it is read.
+  if (same(&d, &b) && !same(&d, &a)) {
+    if (in->op == IR_SUB) {
+      d = op_reg(RAX);
+    } else {
+      Operand tmp = a;
+      a = b;
+      b = tmp;
+    }
+  }
+
+  emit_mov(d, a);
+  switch (in->op) {
+    case IR_ADD:
+      emit(I_ADD, d, b);
+      break;
+    case IR_SUB:
+      emit(I_SUB, d, b);
+      break;
+    case IR_MUL:
+      if (b.kind == OPR_IMM)
+        emit(I_IMUL, d, d)->c = b;
+      else
+        emit(I_IMUL, d, b);
+      break;
+  }
+  emit_mov(locs[in->d], d);
+}
+
+static void gen_div(IrInst* in) {
+  Operand b = rhs_operand(in);
+  emit_mov(op_reg(RAX), locs[in->a]);
+  emit0(I_CQO);
+  if (b.kind == OPR_IMM) {
+    emit(I_MOV, op_reg(RDI), b);
+    b = op_reg(RDI);
+  }
+  emit1(I_IDIV, b);
+  emit_mov(locs[in->d], op_reg(RAX));
+}
+
+static void gen_compare(IrInst* in, CondCode cc) {
+  Operand a = locs[in->a];
+  Operand b = rhs_operand(in);
+  if (!is_reg(&a) && b.kind == OPR_MEM)
+    a = in_reg(a, RAX);
+
+  emit(I_CMP, a, b);
+  emit0(I_SETCC)->cc = cc;
+  Operand d = result_reg(in);
+  emit1(I_MOVZB, d);
+  emit_mov(locs[in->d], d);
+}
+
+static void gen_call(IrInst* in) {
+  for (int i = 0; i < in->nargs; i++)
+    emit_mov(op_reg(argreg[i]), locs[in->args[i]]);
+
+  // RAX is set to 0 for variadic function.
+  emit(I_MOV, op_reg(RAX), op_imm(0));
+  emit1(I_CALL, op_sym(in->funcsym));
+  emit_mov(locs[in->d], op_reg(RAX));
+}
+
+static void gen_inst(IrInst* in) {
+  switch (in->op) {
+    case IR_IMM:
+      emit_mov(locs[in->d], op_imm(in->imm));
       return;
-    case ND_NUM:
-      printf("  push %ld\n", node->val);
+    case IR_NEG: {
+      Operand d = result_reg(in);
+      emit_mov(d, locs[in->a]);
+      emit1(I_NEG, d);
+      emit_mov(locs[in->d], d);
       return;
-    case ND_EXPR_STMT:
-      gen(node->lhs);
-      printf("  add rsp, 8\n");
+    }
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL:
+      gen_arith(in);
       return;
-    case ND_VAR:
-      gen_addr(node);
-      if (node->ty->kind != TY_ARRAY)
-        load();
+    case IR_DIV:
+      gen_div(in);
       return;
-    case ND_ASSIGN:
-      gen_lval(node->lhs);
-      gen(node->rhs);
-      store();
+    case IR_EQ:
+      gen_compare(in, CC_E);
       return;
-    case ND_ADDR:
-      gen_addr(node->lhs);
+    case IR_NE:
+      gen_compare(in, CC_NE);
       return;
-    case ND_DEREF:
-      gen(node->lhs);
-      if (node->ty->kind != TY_ARRAY)
-        load();
+    case IR_LT:
+      gen_compare(in, CC_L);
       return;
-    case ND_IF: {
-      int seq = labelseq++;
-      if (node->els) {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.else.%d\n", seq);
-        gen(node->then);
-        printf("  jmp .L.end.%d\n", seq);
-        printf(".L.else.%d:\n", seq);
-        gen(node->els);
-        printf(".L.end.%d:\n", seq);
-      } else {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.end.%d\n", seq);
-        gen(node->then);
-        printf(".L.end.%d:\n", seq);
-      }
+    case IR_LE:
+      gen_compare(in, CC_LE);
       return;
-    }
-    case ND_WHILE: {
-      int seq = labelseq++;
-      printf(".L.begin.%d:\n", seq);
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je  .L.end.%d\n", seq);
-      gen(node->then);
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.end.%d:\n", seq);
+    case IR_ADDR: {
+      Operand d = result_reg(in);
+      emit(I_LEA, d, var_operand(in->var, in->imm));
+      emit_mov(locs[in->d], d);
       return;
     }
-    case ND_FOR: {
-      int seq = labelseq++;
-      if (node->init) { 
-        gen(node->init);
-      }
-      printf(".L.begin.%d:\n", seq);
-      if (node->cond) { 
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je  .L.end.%d\n", seq);
-      } 
-      gen(node->then);
-      if (node->inc) {
-        gen(node->inc);
-      }
-      printf("  jmp .L.begin.%d\n", seq);
-      printf(".L.end.%d:\n", seq);
+    case IR_LOADV:
+      emit_mov(locs[in->d], var_operand(in->var, in->imm));
       return;
-    }
-    case ND_FUNCALL: {
-      int nargs = 0;
-      for (Node* arg = node->args; arg != NULL; arg = arg->next) {
-        gen(arg);
-        nargs++;
-      }
-      for (int i = nargs - 1; i >= 0; i--) {
-        printf("  pop %s\n", argreg[i]);
-      }
-
-      // We need to align RSP to a 16 byte boundary before
-      // calling a function because it is an ABI requirement.
-      // RAX is set to 0 for variadic function.
-      int seq = labelseq++;
-      printf("  mov rax, rsp\n");
-      printf("  and rax, 15\n");
-      printf("  jnz .L.call.%d\n", seq);  // jump if not zero
-      printf("  mov rax, 0\n");           // for variable parameters
-      printf("  call %s\n", node->funcname);
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.call.%d:\n", seq);
-      printf("  sub rsp, 8\n");
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);
-      printf("  add rsp, 8\n");
-      printf(".L.end.%d:\n", seq);
-      printf("  push rax\n");
+    case IR_STOREV:
+      emit_mov(var_operand(in->var, in->imm), locs[in->a]);
       return;
-    }
-    case ND_BLOCK: {
-      for (Node* cur = node->block; cur != NULL; cur = cur->next) {
-        gen(cur);
-      }
+    case IR_LOAD: {
+      Operand addr = in_reg(locs[in->a], RAX);
+      Operand d = result_reg(in);
+      emit(I_MOV, d, op_mem(addr.reg, in->imm));
+      emit_mov(locs[in->d], d);
       return;
     }
-    case ND_RETURN: {
-      gen(node->lhs);
-      printf("  pop rax\n");
-      printf("  jmp .L.return.%s\n", funcname);
+    case IR_STORE: {
+      Operand addr = in_reg(locs[in->a], RAX);
+      Operand val = in_reg(locs[in->b], RDI);
+      emit(I_MOV, op_mem(addr.reg, in->imm), val);
       return;
     }
+    case IR_CALL:
+      gen_call(in);
+      return;
+    case IR_JMP:
+      emit1(I_JMP, op_label(bb_label(in->then)));
+      return;
+    case IR_BR:
+      emit(I_CMP, locs[in->a], op_imm(0));
+      emit_jcc(CC_E, bb_label(in->els));
+      emit1(I_JMP, op_label(bb_label(in->then)));
+      return;
+    case IR_RET:
+      if (in->a)
+        emit_mov(op_reg(RAX), locs[in->a]);
+      emit1(I_JMP, op_label(return_label));
+      return;
   }
+  error("internal error: unknown IR instruction");
+}
 
-  gen(node->lhs);
-  gen(node->rhs);
+// Generates the instructions of a function into `out`.
+static void gen_function(Function* fn, InstList* out) {
+  // Label numbers are local to the function; labels are qualified
+  // with the function name when printed.
+  return_label = 1;
+  for (BasicBlock* bb = fn->bbs; bb; bb = bb->next)
+    return_label = bb_label(bb) + 1;
 
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
-  
-  switch (node->kind) {
-    case ND_ADD: 
-      printf("  add rax, rdi\n"); 
-      break;
-    case ND_PTR_ADD:
-      printf("  imul rdi, %d\n", node->ty->base->size);
-      printf("  add rax, rdi\n");
-      break;
-    case ND_SUB: 
-      printf("  sub rax, rdi\n");
-      break;
-    case ND_PTR_SUB:
-      printf("  imul rdi, %d\n", node->ty->base->size);
-      printf("  sub rax, rdi\n");
-      break;
-    case ND_PTR_DIFF:
-      printf("  sub rax, rdi\n");
-      printf("  cqo\n");
-      printf("  mov rdi, %d\n", node->lhs->ty->base->size);
-      printf("  idiv rdi\n");
-      break;
-    case ND_MUL:
-      printf("  imul rax, rdi\n"); 
-      break;
-    case ND_DIV:
-      printf("  cqo\n");
-      printf("  idiv rdi\n");  
-      break;
-    case ND_EQ:
-      printf("  cmp rax, rdi\n");
-      printf("  sete al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_NE:
-      printf("  cmp rax, rdi\n");
-      printf("  setne al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_LT:
-      printf("  cmp rax, rdi\n");
-      printf("  setl al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_LE:
-      printf("  cmp rax, rdi\n");
-      printf("  setle al\n");
-      printf("  movzb rax, al\n");
-      break;
-    default: 
-      error("Unkown operator");
+  frame_size = fn->stack_size;
+  allocate_registers(fn);
+  frame_size += nslots * 8;
+
+  int nsaved = 0;
+  for (int i = 0; i < NUM_REGS; i++)
+    if (is_callee_saved(regs[i]) && (used_regs & (1u << regs[i])))
+      nsaved++;
+
+  // Keep RSP 16-byte aligned at call sites, as the ABI requires.
+  // RSP is aligned right after `push rbp`, and the frame and saved
+  // registers are the only things pushed below it.
+  if ((frame_size + nsaved * 8) % 16)
+    frame_size += 8;
+
+  // Prologue
+  insts = out;
+  emit1(I_PUSH, op_reg(RBP));
+  emit(I_MOV, op_reg(RBP), op_reg(RSP));
+  emit(I_SUB, op_reg(RSP), op_imm(frame_size));
+  for (int i = 0; i < NUM_REGS; i++)
+    if (is_callee_saved(regs[i]) && (used_regs & (1u << regs[i])))
+      emit1(I_PUSH, op_reg(regs[i]));
+
+  // Push arguments to the stack
+  int i = 0;
+  for (VarList* vl = fn->params; vl != NULL; vl = vl->next) {
+    Var* var = vl->var;
+    emit(I_MOV, op_mem(RBP, -var->offset), op_reg(argreg[i++]));
+  }
+
+  for (BasicBlock* bb = fn->bbs; bb; bb = bb->next) {
+    emit_label(bb_label(bb));
+    for (IrInst* in = bb->insts; in; in = in->next)
+      gen_inst(in);
   }
 
-  printf("  push rax\n");
+  // Epilogue
+  emit_label(return_label);
+  for (int i = NUM_REGS - 1; i >= 0; i--)
+    if (is_callee_saved(regs[i]) && (used_regs & (1u << regs[i])))
+      emit1(I_POP, op_reg(regs[i]));
+  emit(I_MOV, op_reg(RSP), op_reg(RBP));
+  emit1(I_POP, op_reg(RBP));
+  emit0(I_RET);
+
+  free(locs);
 }
 
-static void emit_data(Program* prog) {
-  printf(".data\n");
+static void emit_data(Program* prog, Buf* out) {
+  buf_puts(out, ".data\n");
 
   for (VarList* vl = prog->globals; vl != NULL; vl = vl->next) {
     Var* var = vl->var;
-    printf("%s:\n", var->name);
-    printf("  .zero %d\n", var->ty->size);
+    buf_printf(out, "%s:\n", sym_name(var->sym));
+    buf_printf(out, "  .zero %d\n", var->ty->size);
   }
 }
 
-static void emit_text(Program* prog) {
-  printf(".text\n");
+//
+// Parallel code generation
+//
 
-  for (Function* fn = prog->fns; fn != NULL; fn = fn->next) {
-    printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
+// The generated code of one function.
+typedef struct {
+  Function* fn;
+  Buf       text;    // Assembly
+  Object    obj;     // Machine code, if writing an object
+  long      ninsts;
+} FuncCode;
 
-    // Prologue
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
+typedef struct {
+  FuncCode*   fns;
+  int         nfns;
+  bool        to_object;
+  atomic_int  next;  // Next function to be taken by a worker
+  SymTable*   syms;  // Symbols of the program
+} Work;
 
-    // Push arguments to the stack
-    int i = 0;
-    for (VarList* vl = fn->params; vl != NULL; vl = vl->next) {
-      Var* var = vl->var;
-      printf("  mov [rbp-%d], %s\n", var->offset, argreg[i++]);
-    }
+static void gen_one(FuncCode* fc, bool to_object) {
+  Function* fn = fc->fn;
+  if (fn->cached) {
+    buf_puts(&fc->text, fn->cached);
+    return;
+  }
 
-    // Emit code
-    for (Node* cur = fn->node; cur != NULL; cur = cur->next) {
-      gen(cur);
-    }
+  InstList list = {};
+  gen_function(fn, &list);
+  if (opt_peephole)
+    peephole(&list);
+
+  if (stats_enabled)
+    for (int i = 0; i < list.len; i++)
+      if (list.data[i].kind != I_NOP && list.data[i].kind != I_LABEL)
+        fc->ninsts++;
+
+  if (to_object) {
+    assemble(&fc->obj, fn->sym, &list);
+  } else {
+    char* name = sym_name(fn->sym);
+    buf_printf(&fc->text, ".global %s\n", name);
+    buf_printf(&fc->text, "%s:\n", name);
+    print_insts(&fc->text, fn->sym, &list);
+    if (fn->cacheable)
+      cache_put(&fn->key, fc->text.data, fc->text.len);
+  }
+  free(list.data);
+}
+
+static void* worker(void* arg) {
+  Work* w = arg;
+  for (int i; (i = w->next++) < w->nfns;)
+    gen_one(&w->fns[i], w->to_object);
+  return NULL;
+}
+
+// Entry point of the threads that help the calling thread.
+static void* worker_thread(void* arg) {
+  Work* w = arg;
+  set_intern_table(w->syms);
+  double cpu = stats_enabled ? thread_cpu_seconds() : 0;
+  worker(w);
+  if (stats_enabled)
+    phase_add_cpu(PH_CODEGEN, thread_cpu_seconds() - cpu);
+  return NULL;
+}
+
+// Generates the code of every function of `prog` on up to opt_jobs
+// threads. Functions share no state, so each is generated into its
+// own buffer, and the results are returned in source order so that
+// the output does not depend on the number of threads.
+static FuncCode* gen_functions(Program* prog, bool to_object, int* nfns) {
+  int n = 0;
+  for (Function* fn = prog->fns; fn; fn = fn->next)
+    n++;
+
+  Work w = { .fns = calloc(n, sizeof(FuncCode)), .nfns = n,
+             .to_object = to_object, .syms = intern_table() };
+  int i = 0;
+  for (Function* fn = prog->fns; fn; fn = fn->next)
+    w.fns[i++].fn = fn;
 
-    // Epilogue
-    printf(".L.return.%s:\n", funcname);
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n"); 
+  phase_begin(PH_CODEGEN);
+  int nthreads = opt_jobs < n ? opt_jobs : n;
+  pthread_t* threads = calloc(nthreads, sizeof(pthread_t));
+  for (int i = 1; i < nthreads; i++) {
+    int err = pthread_create(&threads[i], NULL, worker_thread, &w);
+    if (err)
+      error("cannot create thread: %s", strerror(err));
   }
+  worker(&w);
+  for (int i = 1; i < nthreads; i++)
+    pthread_join(threads[i], NULL);
+  free(threads);
+  phase_end();
+
+  for (int i = 0; i < n; i++)
+    stats.insts += w.fns[i].ninsts;
+  *nfns = n;
+  return w.fns;
+}
+
+// Emits assembly for the lowered program `prog` into `out`.
+void codegen(Program* prog, Buf* out) {
+  int n;
+  FuncCode* fns = gen_functions(prog, false, &n);
+
+  phase_begin(PH_EMIT);
+  buf_puts(out, ".intel_syntax noprefix\n");
+  emit_data(prog, out);
+  buf_puts(out, ".text\n");
+  for (int i = 0; i < n; i++) {
+    buf_putn(out, fns[i].text.data, fns[i].text.len);
+    free(fns[i].text.data);
+  }
+  phase_end();
+  free(fns);
 }
 
-void codegen(Program* prog) {
-  printf(".intel_syntax noprefix\n");
-  emit_data(prog);
-  emit_text(prog);
-}
\ No newline at end of file
+// Assembles the lowered program `prog` into machine code in `obj`.
+void codegen_object(Program* prog, Object* obj) {
+  int n;
+  FuncCode* fns = gen_functions(prog, true, &n);
+
+  phase_begin(PH_EMIT);
+  for (int i = 0; i < n; i++) {
+    obj_append(obj, &fns[i].obj);
+    obj_free(&fns[i].obj);
+  }
+  phase_end();
+  free(fns);
+}
@@ -0,0 +1,315 @@
+#include "litecc.h"
+
+// Dead code elimination.
+//
+// This pass runs over folded ASTs, before frame layout. It removes
+// statements that cannot be reached because they follow a return or
+// an endless loop, expression statements without side effects, and
+// local variables that are never read. Assignments to such a
+// variable are replaced by their right-hand sides, which are kept
+// only if they have side effects, and the variable gets no stack
+// slot.
+//
+// Pointer arithmetic may reach any variable from the address of
+// another, so no variable of a function is removed if one of them
+// has its address taken or is accessed outside its own bounds.
+
+// Expressions are walked with explicit stacks, of nodes or of the
+// fields that refer to them, so deep ones cannot overflow the native
+// stack.
+static _Thread_local Node**  stack;
+static _Thread_local int     depth;
+static _Thread_local int     cap;
+static _Thread_local Node*** slots;
+static _Thread_local int     nslots;
+static _Thread_local int     slots_cap;
+static _Thread_local bool    escapes;
+
+static void push(Node* node) {
+  if (depth == cap) {
+    cap = cap ? cap * 2 : 64;
+    stack = realloc(stack, cap * sizeof(Node*));
+  }
+  stack[depth++] = node;
+}
+
+static void push_slot(Node** slot) {
+  if (nslots == slots_cap) {
+    slots_cap = slots_cap ? slots_cap * 2 : 64;
+    slots = realloc(slots, slots_cap * sizeof(Node**));
+  }
+  slots[nslots++] = slot;
+}
+
+static Node* null_stmt(Node* node) {
+  node->kind = ND_NULL;
+  return node;
+}
+
+// Calls `fn` on the field referring to each expression of a
+// statement.
+static void walk_exprs(Node* node, void (*fn)(Node**)) {
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+      fn(&node->lhs);
+      return;
+    case ND_IF:
+      fn(&node->cond);
+      walk_exprs(node->then, fn);
+      if (node->els)
+        walk_exprs(node->els, fn);
+      return;
+    case ND_WHILE:
+      fn(&node->cond);
+      walk_exprs(node->then, fn);
+      return;
+    case ND_FOR:
+      if (node->init)
+        walk_exprs(node->init, fn);
+      if (node->cond)
+        fn(&node->cond);
+      if (node->inc)
+        walk_exprs(node->inc, fn);
+      walk_exprs(node->then, fn);
+      return;
+    case ND_BLOCK:
+      for (Node* n = node->block; n; n = n->next)
+        walk_exprs(n, fn);
+      return;
+  }
+}
+
+// Checks an access to a local variable. Accesses through the
+// variable's own address at an offset stay within it, but an
+// address that escapes or an access outside the variable may reach
+// others.
+static void check_access(Node* node) {
+  Var* var = node->var;
+  if (node->ty->kind == TY_ARRAY || node->val < 0 ||
+      node->val > var->ty->size - node->ty->size)
+    escapes = true;
+}
+
+// Marks the local variables that `*expr` reads.
+static void mark_reads(Node** expr) {
+  push(*expr);
+  while (depth > 0) {
+    Node* node = stack[--depth];
+    switch (node->kind) {
+      case ND_NUM:
+        break;
+      case ND_VAR:
+        if (node->var->is_local) {
+          check_access(node);
+          node->var->is_read = true;
+        }
+        break;
+      case ND_ADDR:
+        if (node->lhs->kind == ND_VAR)
+          escapes = true;
+        push(node->lhs);
+        break;
+      case ND_ASSIGN:
+        // Storing to a variable does not read it.
+        if (node->lhs->kind == ND_VAR && node->lhs->var->is_local)
+          check_access(node->lhs);
+        else
+          push(node->lhs);
+        push(node->rhs);
+        break;
+      case ND_FUNCALL:
+        for (Node* arg = node->args; arg; arg = arg->next)
+          push(arg);
+        break;
+      default:
+        push(node->lhs);
+        if (node->rhs)
+          push(node->rhs);
+        break;
+    }
+  }
+}
+
+static bool is_dead_store(Node* node) {
+  return node->kind == ND_ASSIGN && node->lhs->kind == ND_VAR &&
+         node->lhs->var->is_local && !node->lhs->var->is_read;
+}
+
+// Replaces assignments to unread variables in `*expr` by their
+// right-hand sides. The fields referring to the nodes are collected
+// breadth first and rewritten in reverse, as in fold_expr().
+static void drop_stores(Node** expr) {
+  push_slot(expr);
+
+  for (int i = 0; i < nslots; i++) {
+    Node* node = *slots[i];
+    switch (node->kind) {
+      case ND_NUM:
+      case ND_VAR:
+        break;
+      case ND_FUNCALL:
+        for (Node** arg = &node->args; *arg; arg = &(*arg)->next)
+          push_slot(arg);
+        break;
+      default:
+        push_slot(&node->lhs);
+        if (node->rhs)
+          push_slot(&node->rhs);
+        break;
+    }
+  }
+
+  for (int i = nslots - 1; i >= 0; i--) {
+    Node* node = *slots[i];
+    if (is_dead_store(node)) {
+      *slots[i] = node->rhs;
+      node->rhs->next = node->next;
+    }
+  }
+  nslots = 0;
+}
+
+// Returns true if control never reaches the end of `node`.
+static bool never_completes(Node* node) {
+  switch (node->kind) {
+    case ND_RETURN:
+      return true;
+    case ND_IF:
+      return node->els && never_completes(node->then) &&
+             never_completes(node->els);
+    case ND_WHILE:
+      return node->cond->kind == ND_NUM;
+    case ND_FOR:
+      return !node->cond;
+    case ND_BLOCK: {
+      Node* last = node->block;
+      while (last && last->next)
+        last = last->next;
+      return last && never_completes(last);
+    }
+    default:
+      return false;
+  }
+}
+
+static Node* prune_list(Node* list);
+
+// Removes statements that have no effect.
+static void prune(Node* node) {
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+      if (is_pure(node->lhs))
+        null_stmt(node);
+      return;
+    case ND_IF:
+      prune(node->then);
+      if (node->els)
+        prune(node->els);
+      if (node->then->kind == ND_NULL &&
+          (!node->els || node->els->kind == ND_NULL) && is_pure(node->cond))
+        null_stmt(node);
+      return;
+    case ND_WHILE:
+      prune(node->then);
+      return;
+    case ND_FOR:
+      if (node->init)
+        prune(node->init);
+      if (node->inc)
+        prune(node->inc);
+      prune(node->then);
+      return;
+    case ND_BLOCK:
+      node->block = prune_list(node->block);
+      if (!node->block)
+        null_stmt(node);
+      return;
+  }
+}
+
+// Prunes a list of statements, dropping empty ones and those that
+// follow a statement that never completes.
+static Node* prune_list(Node* list) {
+  Node head = {};
+  Node* cur = &head;
+  for (Node* n = list; n; n = n->next) {
+    prune(n);
+    if (n->kind == ND_NULL)
+      continue;
+    cur = cur->next = n;
+    if (never_completes(n))
+      break;
+  }
+  cur->next = NULL;
+  return head.next;
+}
+
+static VarList* live_vars(VarList* vars) {
+  VarList head = {};
+  VarList* cur = &head;
+  for (VarList* vl = vars; vl; vl = vl->next)
+    if (vl->var->is_read)
+      cur = cur->next = vl;
+  cur->next = NULL;
+  return head.next;
+}
+
+// Removes unread variables from the declarations of blocks.
+static void drop_decls(Node* node) {
+  switch (node->kind) {
+    case ND_IF:
+      drop_decls(node->then);
+      if (node->els)
+        drop_decls(node->els);
+      return;
+    case ND_WHILE:
+    case ND_FOR:
+      drop_decls(node->then);
+      return;
+    case ND_BLOCK:
+      node->decls = live_vars(node->decls);
+      for (Node* n = node->block; n; n = n->next)
+        drop_decls(n);
+      return;
+  }
+}
+
+// Removes the unread variables of `fn`. Returns true if there were
+// any.
+static bool drop_vars(Function* fn) {
+  escapes = false;
+  for (VarList* vl = fn->locals; vl; vl = vl->next)
+    vl->var->is_read = false;
+  for (VarList* vl = fn->params; vl; vl = vl->next)
+    vl->var->is_read = true;
+  for (Node* n = fn->node; n; n = n->next)
+    walk_exprs(n, mark_reads);
+  if (escapes)
+    return false;
+
+  bool found = false;
+  for (VarList* vl = fn->locals; vl; vl = vl->next)
+    found |= !vl->var->is_read;
+  if (!found)
+    return false;
+
+  for (Node* n = fn->node; n; n = n->next) {
+    walk_exprs(n, drop_stores);
+    drop_decls(n);
+  }
+  fn->locals = live_vars(fn->locals);
+  fn->decls = live_vars(fn->decls);
+  return true;
+}
+
+void eliminate_dead_code(Program* prog) {
+  for (Function* fn = prog->fns; fn; fn = fn->next) {
+    if (fn->cached)
+      continue;
+    fn->node = prune_list(fn->node);
+    // Dropping a variable may leave others unread.
+    while (drop_vars(fn))
+      fn->node = prune_list(fn->node);
+  }
+}
@@ -0,0 +1,220 @@
+#include "litecc.h"
+
+// ELF64 relocatable object writer.
+//
+// Writes the code encoded by asm.c together with global variables
+// as an object file that the system linker accepts. The file has
+// the following sections:
+//
+//   .text       code of all functions
+//   .data       global variables, zero-initialized
+//   .rela.text  relocations against .text
+//   .symtab     global variables (local), functions (global) and
+//               undefined functions called from this file
+//   .strtab     symbol names
+//   .note.GNU-stack  marks the stack as non-executable
+//   .shstrtab   section names
+
+enum {
+  SEC_NULL,
+  SEC_TEXT,
+  SEC_DATA,
+  SEC_RELA,
+  SEC_SYMTAB,
+  SEC_STRTAB,
+  SEC_NOTE,
+  SEC_SHSTRTAB,
+  NUM_SECTIONS,
+};
+
+void obj_add_reloc(Object* obj, long offset, int sym, int type, long addend) {
+  if (obj->nrelocs == obj->relocs_cap) {
+    obj->relocs_cap = obj->relocs_cap ? obj->relocs_cap * 2 : 64;
+    obj->relocs = realloc(obj->relocs, obj->relocs_cap * sizeof(Reloc));
+  }
+  obj->relocs[obj->nrelocs++] = (Reloc){ offset, sym, type, addend };
+}
+
+void obj_add_func(Object* obj, int sym, long offset, long size) {
+  if (obj->nfuncs == obj->funcs_cap) {
+    obj->funcs_cap = obj->funcs_cap ? obj->funcs_cap * 2 : 16;
+    obj->funcs = realloc(obj->funcs, obj->funcs_cap * sizeof(FuncSym));
+  }
+  obj->funcs[obj->nfuncs++] = (FuncSym){ sym, offset, size };
+}
+
+// Appends the code of `src` to `dst`, rebasing its relocations and
+// function symbols.
+void obj_append(Object* dst, Object* src) {
+  long base = dst->text.len;
+  buf_putn(&dst->text, src->text.data, src->text.len);
+  for (int i = 0; i < src->nrelocs; i++) {
+    Reloc* r = &src->relocs[i];
+    obj_add_reloc(dst, base + r->offset, r->sym, r->type, r->addend);
+  }
+  for (int i = 0; i < src->nfuncs; i++) {
+    FuncSym* fn = &src->funcs[i];
+    obj_add_func(dst, fn->sym, base + fn->offset, fn->size);
+  }
+}
+
+void obj_free(Object* obj) {
+  free(obj->text.data);
+  free(obj->relocs);
+  free(obj->funcs);
+}
+
+// Appends a NUL-terminated string to a string table and returns its
+// offset.
+static int add_string(Buf* tab, char* s) {
+  int off = tab->len;
+  buf_putn(tab, s, strlen(s) + 1);
+  return off;
+}
+
+static void align_to(Buf* buf, int align) {
+  while (buf->len % align)
+    buf_putc(buf, 0);
+}
+
+typedef struct {
+  Buf      syms;     // Elf64_Sym entries
+  Buf      strtab;
+  HashMap  index;    // Symbol ID -> symbol table index
+  int      nsyms;
+} SymTab;
+
+static void add_symbol(SymTab* tab, int sym, int bind, int type, int shndx,
+                       long value, long size) {
+  Elf64_Sym esym = {
+    .st_name = sym ? add_string(&tab->strtab, sym_name(sym)) : 0,
+    .st_info = ELF64_ST_INFO(bind, type),
+    .st_shndx = shndx,
+    .st_value = value,
+    .st_size = size,
+  };
+  buf_putn(&tab->syms, (char*)&esym, sizeof(esym));
+  if (sym)
+    hashmap_put(&tab->index, sym, (void*)(long)tab->nsyms);
+  tab->nsyms++;
+}
+
+void write_elf(Object* obj, VarList* globals, Buf* out) {
+  SymTab tab = {};
+  add_string(&tab.strtab, "");
+  add_symbol(&tab, 0, STB_LOCAL, STT_NOTYPE, SHN_UNDEF, 0, 0);
+
+  // Local symbols must come first. Global variables are local to
+  // the file, as in the assembly output.
+  long data_size = 0;
+  for (VarList* vl = globals; vl; vl = vl->next) {
+    Var* var = vl->var;
+    add_symbol(&tab, var->sym, STB_LOCAL, STT_OBJECT, SEC_DATA, data_size,
+               var->ty->size);
+    data_size += var->ty->size;
+  }
+  int first_global = tab.nsyms;
+
+  for (int i = 0; i < obj->nfuncs; i++) {
+    FuncSym* fn = &obj->funcs[i];
+    add_symbol(&tab, fn->sym, STB_GLOBAL, STT_FUNC, SEC_TEXT, fn->offset,
+               fn->size);
+  }
+
+  // Anything else that is referenced is defined elsewhere.
+  for (int i = 0; i < obj->nrelocs; i++) {
+    int sym = obj->relocs[i].sym;
+    if (!hashmap_get(&tab.index, sym))
+      add_symbol(&tab, sym, STB_GLOBAL, STT_NOTYPE, SHN_UNDEF, 0, 0);
+  }
+
+  Buf rela = {};
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc* r = &obj->relocs[i];
+    long idx = (long)hashmap_get(&tab.index, r->sym);
+    Elf64_Rela erela = {
+      .r_offset = r->offset,
+      .r_info = ELF64_R_INFO(idx, r->type),
+      .r_addend = r->addend,
+    };
+    buf_putn(&rela, (char*)&erela, sizeof(erela));
+  }
+
+  Buf shstrtab = {};
+  add_string(&shstrtab, "");
+
+  Elf64_Shdr shdrs[NUM_SECTIONS] = {};
+  struct {
+    char* name;
+    int   type;
+    int   flags;
+    char* data;
+    long  size;
+    int   align;
+  } secs[NUM_SECTIONS] = {
+    [SEC_TEXT] = { ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+                   obj->text.data, obj->text.len, 16 },
+    [SEC_DATA] = { ".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE,
+                   NULL, data_size, 8 },
+    [SEC_RELA] = { ".rela.text", SHT_RELA, SHF_INFO_LINK,
+                   rela.data, rela.len, 8 },
+    [SEC_SYMTAB] = { ".symtab", SHT_SYMTAB, 0,
+                     tab.syms.data, tab.syms.len, 8 },
+    [SEC_STRTAB] = { ".strtab", SHT_STRTAB, 0,
+                     tab.strtab.data, tab.strtab.len, 1 },
+    [SEC_NOTE] = { ".note.GNU-stack", SHT_PROGBITS, 0, NULL, 0, 1 },
+    [SEC_SHSTRTAB] = { ".shstrtab", SHT_STRTAB, 0, NULL, 0, 1 },
+  };
+
+  for (int i = 1; i < NUM_SECTIONS; i++)
+    shdrs[i].sh_name = add_string(&shstrtab, secs[i].name);
+  secs[SEC_SHSTRTAB].data = shstrtab.data;
+  secs[SEC_SHSTRTAB].size = shstrtab.len;
+
+  // Section contents follow the ELF header; the section header table
+  // comes last.
+  Elf64_Ehdr ehdr = {
+    .e_ident = { ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64,
+                 ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV },
+    .e_type = ET_REL,
+    .e_machine = EM_X86_64,
+    .e_version = EV_CURRENT,
+    .e_ehsize = sizeof(Elf64_Ehdr),
+    .e_shentsize = sizeof(Elf64_Shdr),
+    .e_shnum = NUM_SECTIONS,
+    .e_shstrndx = SEC_SHSTRTAB,
+  };
+  buf_putn(out, (char*)&ehdr, sizeof(ehdr));
+
+  for (int i = 1; i < NUM_SECTIONS; i++) {
+    align_to(out, secs[i].align);
+    Elf64_Shdr* sh = &shdrs[i];
+    sh->sh_type = secs[i].type;
+    sh->sh_flags = secs[i].flags;
+    sh->sh_offset = out->len;
+    sh->sh_size = secs[i].size;
+    sh->sh_addralign = secs[i].align;
+    if (secs[i].data)
+      buf_putn(out, secs[i].data, secs[i].size);
+    else
+      for (long j = 0; j < secs[i].size; j++)
+        buf_putc(out, 0);
+  }
+
+  shdrs[SEC_RELA].sh_link = SEC_SYMTAB;
+  shdrs[SEC_RELA].sh_info = SEC_TEXT;
+  shdrs[SEC_RELA].sh_entsize = sizeof(Elf64_Rela);
+  shdrs[SEC_SYMTAB].sh_link = SEC_STRTAB;
+  shdrs[SEC_SYMTAB].sh_info = first_global;
+  shdrs[SEC_SYMTAB].sh_entsize = sizeof(Elf64_Sym);
+
+  align_to(out, 8);
+  ((Elf64_Ehdr*)out->data)->e_shoff = out->len;
+  buf_putn(out, (char*)shdrs, sizeof(shdrs));
+
+  free(tab.syms.data);
+  free(tab.strtab.data);
+  free(tab.index.buckets);
+  free(rela.data);
+  free(shstrtab.data);
+}
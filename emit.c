@@ -0,0 +1,100 @@
+#include "litecc.h"
+
+// Output buffer for generated code.
+//
+// Code generation appends text to a growable in-memory buffer rather
+// than going through stdio for every line, and the whole buffer is
+// written out at once when it is complete. buf_printf() understands
+// only the handful of conversions the code generator needs, which
+// avoids printf's format parsing, locale handling and stream locking.
+
+static void buf_reserve(Buf* buf, size_t n) {
+  if (buf->len + n <= buf->cap)
+    return;
+  size_t cap = buf->cap ? buf->cap : 4096;
+  while (cap < buf->len + n)
+    cap *= 2;
+  buf->data = realloc(buf->data, cap);
+  buf->cap = cap;
+}
+
+void buf_putn(Buf* buf, char* s, size_t n) {
+  buf_reserve(buf, n);
+  memcpy(buf->data + buf->len, s, n);
+  buf->len += n;
+}
+
+void buf_puts(Buf* buf, char* s) {
+  buf_putn(buf, s, strlen(s));
+}
+
+void buf_putc(Buf* buf, char c) {
+  buf_reserve(buf, 1);
+  buf->data[buf->len++] = c;
+}
+
+// Appends the decimal representation of `val`.
+void buf_putint(Buf* buf, long val) {
+  char tmp[24];
+  char* p = tmp + sizeof(tmp);
+  unsigned long u = val < 0 ? -(unsigned long)val : (unsigned long)val;
+
+  do {
+    *--p = '0' + u % 10;
+    u /= 10;
+  } while (u);
+  if (val < 0)
+    *--p = '-';
+
+  buf_putn(buf, p, tmp + sizeof(tmp) - p);
+}
+
+// Appends formatted text. Supported conversions are %s, %d, %ld
+// and %%.
+void buf_vprintf(Buf* buf, char* fmt, va_list ap) {
+  for (char* p = fmt; *p;) {
+    if (*p != '%') {
+      char* q = p;
+      while (*p && *p != '%')
+        p++;
+      buf_putn(buf, q, p - q);
+      continue;
+    }
+
+    switch (p[1]) {
+      case 's':
+        buf_puts(buf, va_arg(ap, char*));
+        p += 2;
+        continue;
+      case 'd':
+        buf_putint(buf, va_arg(ap, int));
+        p += 2;
+        continue;
+      case 'l':
+        if (p[2] == 'd') {
+          buf_putint(buf, va_arg(ap, long));
+          p += 3;
+          continue;
+        }
+        break;
+      case '%':
+        buf_putc(buf, '%');
+        p += 2;
+        continue;
+    }
+    error("internal error: unsupported format: %s", fmt);
+  }
+}
+
+void buf_printf(Buf* buf, char* fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  buf_vprintf(buf, fmt, ap);
+  va_end(ap);
+}
+
+// Writes the buffer to `out` in one go.
+void buf_write(Buf* buf, FILE* out) {
+  if (buf->len && fwrite(buf->data, 1, buf->len, out) != buf->len)
+    error("cannot write output: %s", strerror(errno));
+}
@@ -0,0 +1,333 @@
+#include "litecc.h"
+
+// Constant folding and algebraic simplification.
+//
+// This pass runs over typed ASTs. It evaluates operators whose
+// operands are constants, removes identity operations, folds
+// constant pointer offsets into the variable being addressed and
+// drops branches whose condition is known at compile time. Nodes
+// are rewritten in place where possible.
+
+static Node* fold_stmt(Node* node);
+
+static bool is_num(Node* node, long val) {
+  return node->kind == ND_NUM && node->val == val;
+}
+
+// Expression trees are walked with explicit stacks rather than by
+// recursion, so that deeply nested ones cannot overflow the native
+// stack. `slots` holds pointers to the fields that refer to nodes.
+static _Thread_local Node*** slots;
+static _Thread_local int     nslots;
+static _Thread_local int     slots_cap;
+
+static void push_slot(Node** slot) {
+  if (nslots == slots_cap) {
+    slots_cap = slots_cap ? slots_cap * 2 : 64;
+    slots = realloc(slots, slots_cap * sizeof(Node**));
+  }
+  slots[nslots++] = slot;
+}
+
+// Returns true if evaluating `node` has no side effects.
+bool is_pure(Node* node) {
+  int base = nslots;
+  push_slot(&node);
+
+  while (nslots > base) {
+    Node* n = *slots[--nslots];
+    if (n->kind == ND_ASSIGN || n->kind == ND_FUNCALL) {
+      nslots = base;
+      return false;
+    }
+    if (n->kind == ND_NUM || n->kind == ND_VAR)
+      continue;
+    if (n->lhs)
+      push_slot(&n->lhs);
+    if (n->rhs)
+      push_slot(&n->rhs);
+  }
+  return true;
+}
+
+static Node* to_num(Node* node, long val) {
+  node->kind = ND_NUM;
+  node->val = val;
+  node->ty = int_type;
+  return node;
+}
+
+// Evaluates a binary operator over two constants. Returns false if
+// the operation cannot be folded. Arithmetic wraps around as it does
+// in the generated code.
+static bool eval_binary(NodeKind kind, long l, long r, long* val) {
+  switch (kind) {
+    case ND_ADD: *val = (long)((unsigned long)l + r); return true;
+    case ND_SUB: *val = (long)((unsigned long)l - r); return true;
+    case ND_MUL: *val = (long)((unsigned long)l * r); return true;
+    case ND_DIV:
+      if (r == 0 || (l == LONG_MIN && r == -1))
+        return false;
+      *val = l / r;
+      return true;
+    case ND_EQ: *val = l == r; return true;
+    case ND_NE: *val = l != r; return true;
+    case ND_LT: *val = l < r; return true;
+    case ND_LE: *val = l <= r; return true;
+    default: return false;
+  }
+}
+
+// Returns the variable whose address `node` evaluates to, or NULL.
+// Arrays decay to the address of their first element.
+static Node* addr_of_var(Node* node) {
+  if (node->kind == ND_VAR && node->ty->kind == TY_ARRAY)
+    return node;
+  if (node->kind == ND_ADDR && node->lhs->kind == ND_VAR)
+    return node->lhs;
+  return NULL;
+}
+
+static Node* fold_ptr_add(Node* node) {
+  Node* lhs = node->lhs;
+  Node* rhs = node->rhs;
+  if (rhs->kind != ND_NUM)
+    return node;
+
+  // p+0 ==> p
+  if (rhs->val == 0)
+    return lhs;
+
+  // (p+a)+b ==> p+(a+b)
+  if (lhs->kind == ND_PTR_ADD && lhs->rhs->kind == ND_NUM &&
+      lhs->ty->base->size == node->ty->base->size) {
+    rhs->val = (long)((unsigned long)rhs->val + lhs->rhs->val);
+    node->lhs = lhs->lhs;
+    return fold_ptr_add(node);
+  }
+  return node;
+}
+
+static Node* fold_binary(Node* node) {
+  Node* lhs = node->lhs;
+  Node* rhs = node->rhs;
+  long val;
+
+  if (lhs->kind == ND_NUM && rhs->kind == ND_NUM &&
+      eval_binary(node->kind, lhs->val, rhs->val, &val))
+    return to_num(node, val);
+
+  switch (node->kind) {
+    case ND_ADD:
+    case ND_MUL:
+    case ND_EQ:
+    case ND_NE:
+      // Keep constants on the right-hand side of commutative operators.
+      if (lhs->kind == ND_NUM) {
+        node->lhs = rhs;
+        node->rhs = lhs;
+        lhs = node->lhs;
+        rhs = node->rhs;
+      }
+      break;
+  }
+
+  switch (node->kind) {
+    case ND_ADD:
+      // x+0 ==> x
+      if (is_num(rhs, 0))
+        return lhs;
+      // (x+a)+b ==> x+(a+b)
+      if (rhs->kind == ND_NUM && lhs->kind == ND_ADD &&
+          lhs->rhs->kind == ND_NUM) {
+        rhs->val = (long)((unsigned long)rhs->val + lhs->rhs->val);
+        node->lhs = lhs->lhs;
+        return fold_binary(node);
+      }
+      return node;
+    case ND_SUB:
+      // x-0 ==> x
+      if (is_num(rhs, 0))
+        return lhs;
+      // x-a ==> x+(-a)
+      if (rhs->kind == ND_NUM && rhs->val != LONG_MIN) {
+        rhs->val = -rhs->val;
+        node->kind = ND_ADD;
+        return fold_binary(node);
+      }
+      // 0-(0-x) ==> x
+      if (is_num(lhs, 0) && rhs->kind == ND_SUB && is_num(rhs->lhs, 0))
+        return rhs->rhs;
+      return node;
+    case ND_MUL:
+      // x*1 ==> x
+      if (is_num(rhs, 1))
+        return lhs;
+      // x*0 ==> 0
+      if (is_num(rhs, 0) && is_pure(lhs))
+        return to_num(node, 0);
+      return node;
+    case ND_DIV:
+      // x/1 ==> x
+      if (is_num(rhs, 1))
+        return lhs;
+      return node;
+    case ND_PTR_ADD:
+      return fold_ptr_add(node);
+    case ND_PTR_SUB:
+      // p-a ==> p+(-a)
+      if (rhs->kind == ND_NUM && rhs->val != LONG_MIN) {
+        rhs->val = -rhs->val;
+        node->kind = ND_PTR_ADD;
+        return fold_ptr_add(node);
+      }
+      return node;
+    default:
+      return node;
+  }
+}
+
+static Node* fold_deref(Node* node) {
+  // *(&x+a) ==> x at a byte displacement, so that the access can be
+  // addressed relative to the variable directly.
+  Node* addr = node->lhs;
+  Node* var;
+
+  if ((var = addr_of_var(addr)) != NULL) {
+    node->kind = ND_VAR;
+    node->var = var->var;
+    node->val = var->val;
+    return node;
+  }
+
+  if (addr->kind == ND_PTR_ADD && addr->rhs->kind == ND_NUM &&
+      (var = addr_of_var(addr->lhs)) != NULL) {
+    node->kind = ND_VAR;
+    node->var = var->var;
+    node->val = (long)((unsigned long)var->val +
+                       (unsigned long)addr->rhs->val * addr->ty->base->size);
+    return node;
+  }
+  return node;
+}
+
+// Rewrites a node whose operands have been folded.
+static Node* fold_node(Node* node) {
+  switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+    case ND_FUNCALL:
+    case ND_ADDR:
+    case ND_ASSIGN:
+      return node;
+    case ND_DEREF:
+      return fold_deref(node);
+    default:
+      return fold_binary(node);
+  }
+}
+
+// Folds an expression in post-order. The fields referring to its
+// nodes are collected breadth first, so each comes after the field
+// referring to its parent and after the one referring to its
+// preceding argument, and then rewritten in reverse. A node that is
+// replaced hands its place in an argument list to its replacement.
+static Node* fold_expr(Node* node) {
+  int base = nslots;
+  push_slot(&node);
+
+  for (int i = base; i < nslots; i++) {
+    Node* n = *slots[i];
+    if (n->kind == ND_FUNCALL) {
+      for (Node** arg = &n->args; *arg; arg = &(*arg)->next)
+        push_slot(arg);
+      continue;
+    }
+    if (n->kind == ND_NUM || n->kind == ND_VAR)
+      continue;
+    if (n->lhs)
+      push_slot(&n->lhs);
+    if (n->rhs)
+      push_slot(&n->rhs);
+  }
+
+  for (int i = nslots - 1; i >= base; i--) {
+    Node* n = *slots[i];
+    Node* next = n->next;
+    *slots[i] = fold_node(n);
+    (*slots[i])->next = next;
+  }
+  nslots = base;
+  return node;
+}
+
+static Node* null_stmt(Node* node) {
+  node->kind = ND_NULL;
+  return node;
+}
+
+static Node* fold_stmt(Node* node) {
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+      node->lhs = fold_expr(node->lhs);
+      return node;
+    case ND_IF:
+      node->cond = fold_expr(node->cond);
+      node->then = fold_stmt(node->then);
+      if (node->els)
+        node->els = fold_stmt(node->els);
+      if (node->cond->kind == ND_NUM) {
+        if (node->cond->val)
+          return node->then;
+        return node->els ? node->els : null_stmt(node);
+      }
+      return node;
+    case ND_WHILE:
+      node->cond = fold_expr(node->cond);
+      node->then = fold_stmt(node->then);
+      if (is_num(node->cond, 0))
+        return null_stmt(node);
+      return node;
+    case ND_FOR:
+      if (node->init)
+        node->init = fold_stmt(node->init);
+      if (node->cond)
+        node->cond = fold_expr(node->cond);
+      if (node->inc)
+        node->inc = fold_stmt(node->inc);
+      node->then = fold_stmt(node->then);
+      if (node->cond && is_num(node->cond, 0))
+        return node->init ? node->init : null_stmt(node);
+      // for (;1;) is for (;;)
+      if (node->cond && node->cond->kind == ND_NUM)
+        node->cond = NULL;
+      return node;
+    case ND_BLOCK: {
+      Node head = {};
+      Node* cur = &head;
+      for (Node* n = node->block; n; n = n->next) {
+        Node* next = n->next;
+        cur = cur->next = fold_stmt(n);
+        cur->next = next;
+      }
+      node->block = head.next;
+      return node;
+    }
+    default:
+      return node;
+  }
+}
+
+void fold(Program* prog) {
+  for (Function* fn = prog->fns; fn; fn = fn->next) {
+    Node head = {};
+    Node* cur = &head;
+    for (Node* n = fn->node; n; n = n->next) {
+      Node* next = n->next;
+      cur = cur->next = fold_stmt(n);
+      cur->next = next;
+    }
+    fn->node = head.next;
+  }
+}
@@ -0,0 +1,70 @@
+#include "litecc.h"
+
+// Stack frame layout.
+//
+// Assigns each local variable an offset below the frame pointer. A
+// variable lives only as long as the block that declares it, so the
+// variables of a block are placed right after those of the enclosing
+// blocks, and sibling blocks reuse the same slots. Each variable is
+// aligned to its natural alignment, and the frame is rounded to 16
+// bytes, the stack alignment the ABI requires.
+//
+// Within a block, later declarations get lower addresses, so that
+// consecutive variables of the same type are laid out like an array
+// starting at the first one.
+
+static _Thread_local int max_offset;
+
+static int align_to(int n, int align) {
+  return (n + align - 1) / align * align;
+}
+
+static int align_of(Type* ty) {
+  if (ty->kind == TY_ARRAY)
+    return align_of(ty->base);
+  return ty->size;
+}
+
+// Places the variables in `decls` below `offset` and returns the new
+// end of the frame. `decls` is in reverse order of declaration.
+static int place(VarList* decls, int offset) {
+  for (VarList* vl = decls; vl; vl = vl->next) {
+    Var* var = vl->var;
+    offset = align_to(offset + var->ty->size, align_of(var->ty));
+    var->offset = offset;
+  }
+  if (offset > max_offset)
+    max_offset = offset;
+  return offset;
+}
+
+static void layout_stmt(Node* node, int offset) {
+  switch (node->kind) {
+    case ND_IF:
+      layout_stmt(node->then, offset);
+      if (node->els)
+        layout_stmt(node->els, offset);
+      return;
+    case ND_WHILE:
+    case ND_FOR:
+      layout_stmt(node->then, offset);
+      return;
+    case ND_BLOCK:
+      offset = place(node->decls, offset);
+      for (Node* n = node->block; n; n = n->next)
+        layout_stmt(n, offset);
+      return;
+  }
+}
+
+void layout_frames(Program* prog) {
+  for (Function* fn = prog->fns; fn; fn = fn->next) {
+    if (fn->cached)
+      continue;
+    max_offset = 0;
+    int offset = place(fn->decls, 0);
+    for (Node* n = fn->node; n; n = n->next)
+      layout_stmt(n, offset);
+    fn->stack_size = align_to(max_offset, 16);
+  }
+}
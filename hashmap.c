@@ -0,0 +1,68 @@
+#include "litecc.h"
+
+// Open-addressed hash map with linear probing from positive integer
+// keys (typically symbol IDs) to pointers. Entries are never
+// removed, so no tombstones are needed; key 0 marks an empty bucket.
+
+#define INIT_SIZE 64
+
+static uint32_t hash_key(int key) {
+  return (uint32_t)key * 2654435761u;
+}
+
+static void rehash(HashMap* map) {
+  int cap = map->capacity ? map->capacity * 2 : INIT_SIZE;
+  HashEntry* buckets = calloc(cap, sizeof(HashEntry));
+
+  for (int i = 0; i < map->capacity; i++) {
+    HashEntry* ent = &map->buckets[i];
+    if (!ent->key)
+      continue;
+    uint32_t j = hash_key(ent->key) & (cap - 1);
+    while (buckets[j].key)
+      j = (j + 1) & (cap - 1);
+    buckets[j] = *ent;
+  }
+
+  free(map->buckets);
+  map->buckets = buckets;
+  map->capacity = cap;
+}
+
+void* hashmap_get(HashMap* map, int key) {
+  if (!map->capacity)
+    return NULL;
+
+  for (uint32_t i = hash_key(key) & (map->capacity - 1);;
+       i = (i + 1) & (map->capacity - 1)) {
+    HashEntry* ent = &map->buckets[i];
+    if (ent->key == key)
+      return ent->val;
+    if (!ent->key)
+      return NULL;
+  }
+}
+
+// Returns the address of the value for `key`, inserting a NULL value
+// first if the key is not in the map yet.
+void** hashmap_slot(HashMap* map, int key) {
+  // Keep the load factor below 1/2.
+  if (map->used * 2 >= map->capacity)
+    rehash(map);
+
+  uint32_t i = hash_key(key) & (map->capacity - 1);
+  while (map->buckets[i].key && map->buckets[i].key != key)
+    i = (i + 1) & (map->capacity - 1);
+
+  HashEntry* ent = &map->buckets[i];
+  if (!ent->key) {
+    ent->key = key;
+    ent->val = NULL;
+    map->used++;
+  }
+  return &ent->val;
+}
+
+void hashmap_put(HashMap* map, int key, void* val) {
+  *hashmap_slot(map, key) = val;
+}
@@ -0,0 +1,123 @@
+#include "litecc.h"
+
+// All distinct identifiers are interned into a table, so that two
+// names are equal if and only if their symbol IDs are equal. A
+// symbol ID is an index into `syms`; ID 0 means "no symbol".
+//
+// Each thread that compiles a file has a table of its own, created
+// on first use. Threads that generate code for a file share the
+// table of the thread that parsed it (see intern_table()), and only
+// read from it.
+typedef struct {
+  char*    name;  // NUL-terminated copy of the name
+  int      len;   // Name length
+  uint32_t hash;  // Hash of the name
+} Symbol;
+
+struct SymTable {
+  Symbol* syms;
+  int     nsyms;
+  int     symcap;
+
+  // Open-addressed hash table of symbol IDs. 0 marks an empty bucket.
+  int*    buckets;
+  int     nbuckets;
+
+  // Interned names are copied into large chunks of this pool.
+  char*   pool;
+  size_t  pool_left;
+};
+
+#define POOL_CHUNK_SIZE (64 * 1024)
+
+static _Thread_local SymTable* tab;
+
+// Returns the symbol table of the calling thread.
+SymTable* intern_table(void) {
+  if (!tab)
+    tab = calloc(1, sizeof(SymTable));
+  return tab;
+}
+
+// Makes the calling thread use the symbol table `t`.
+void set_intern_table(SymTable* t) {
+  tab = t;
+}
+
+static char* pool_strndup(char* str, size_t len) {
+  if (tab->pool_left < len + 1) {
+    size_t sz = len + 1 > POOL_CHUNK_SIZE ? len + 1 : POOL_CHUNK_SIZE;
+    tab->pool = malloc(sz);
+    tab->pool_left = sz;
+  }
+  char* s = tab->pool;
+  stats.mem_bytes[MEM_NAMES] += len + 1;
+  stats.mem_objects[MEM_NAMES]++;
+  memcpy(s, str, len);
+  s[len] = '\0';
+  tab->pool += len + 1;
+  tab->pool_left -= len + 1;
+  return s;
+}
+
+// FNV-1a
+uint32_t hash_string(char* str, int len) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; i++)
+    h = (h ^ (unsigned char)str[i]) * 16777619u;
+  return h;
+}
+
+static void rehash(void) {
+  int n = tab->nbuckets ? tab->nbuckets * 2 : 1024;
+  int* b = calloc(n, sizeof(int));
+
+  for (int sym = 1; sym < tab->nsyms; sym++) {
+    uint32_t i = tab->syms[sym].hash & (n - 1);
+    while (b[i])
+      i = (i + 1) & (n - 1);
+    b[i] = sym;
+  }
+
+  free(tab->buckets);
+  tab->buckets = b;
+  tab->nbuckets = n;
+}
+
+// Returns the symbol ID of `str` of length `len` whose hash_string()
+// value is `hash`, adding it to the table if it is new.
+int intern_hashed(char* str, int len, uint32_t hash) {
+  intern_table();
+
+  // Keep the load factor below 1/2.
+  if (tab->nsyms * 2 >= tab->nbuckets)
+    rehash();
+
+  uint32_t mask = tab->nbuckets - 1;
+  uint32_t i = hash & mask;
+  for (int sym; (sym = tab->buckets[i]) != 0; i = (i + 1) & mask) {
+    Symbol* s = &tab->syms[sym];
+    if (s->hash == hash && s->len == len && !memcmp(s->name, str, len))
+      return sym;
+  }
+
+  if (tab->nsyms == 0)
+    tab->nsyms = 1;
+  if (tab->nsyms >= tab->symcap) {
+    tab->symcap = tab->symcap ? tab->symcap * 2 : 1024;
+    tab->syms = realloc(tab->syms, tab->symcap * sizeof(Symbol));
+  }
+
+  int sym = tab->nsyms++;
+  tab->syms[sym] = (Symbol){ pool_strndup(str, len), len, hash };
+  tab->buckets[i] = sym;
+  return sym;
+}
+
+int intern(char* str, int len) {
+  return intern_hashed(str, len, hash_string(str, len));
+}
+
+char* sym_name(int sym) {
+  return tab->syms[sym].name;
+}
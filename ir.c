@@ -0,0 +1,507 @@
+#include "litecc.h"
+
+// Lowering from ASTs to three-address code.
+//
+// Each function becomes a list of basic blocks in layout order. A
+// block ends with a jump, a branch or a return; control never falls
+// off the end of a block. Expressions are flattened into
+// instructions that compute their results into fresh virtual
+// registers, leaving register allocation to the backend.
+
+static _Thread_local Function*   fn;
+static _Thread_local BasicBlock* cur_bb;    // Block being appended to
+static _Thread_local BasicBlock* last_bb;   // Last block in layout order
+static _Thread_local int         nblocks;
+
+static BasicBlock* new_bb(void) {
+  return region_alloc(MEM_IR, sizeof(BasicBlock));
+}
+
+static bool is_terminated(BasicBlock* bb) {
+  if (!bb->last)
+    return false;
+  IrOp op = bb->last->op;
+  return op == IR_JMP || op == IR_BR || op == IR_RET;
+}
+
+static IrInst* new_inst(IrOp op) {
+  IrInst* in = region_alloc(MEM_IR, sizeof(IrInst));
+  in->op = op;
+  stats.ir_insts++;
+  if (cur_bb->last)
+    cur_bb->last = cur_bb->last->next = in;
+  else
+    cur_bb->insts = cur_bb->last = in;
+  return in;
+}
+
+static int new_vreg(void) {
+  return ++fn->nvregs;
+}
+
+static void emit_jmp(BasicBlock* bb) {
+  new_inst(IR_JMP)->then = bb;
+}
+
+// Makes `bb` the current block, placing it after the last one. If
+// the previous block has not been terminated, it falls through to
+// `bb` with an explicit jump.
+static void start_bb(BasicBlock* bb) {
+  if (cur_bb && !is_terminated(cur_bb))
+    emit_jmp(bb);
+  bb->id = ++nblocks;
+  if (last_bb)
+    last_bb->next = bb;
+  else
+    fn->bbs = bb;
+  last_bb = cur_bb = bb;
+}
+
+// Returns true if `node` is a constant that fits in an instruction's
+// 32-bit immediate field after scaling by `scale`.
+static bool is_imm(Node* node, int scale) {
+  // A 32-bit value times a type size cannot overflow.
+  return node->kind == ND_NUM && is_imm32(node->val) &&
+         is_imm32(node->val * scale);
+}
+
+static int emit_def(IrOp op, int a, int b, long imm) {
+  IrInst* in = new_inst(op);
+  in->d = new_vreg();
+  in->a = a;
+  in->b = b;
+  in->imm = imm;
+  return in->d;
+}
+
+static int emit_var(IrOp op, Var* var, long offset) {
+  IrInst* in = new_inst(op);
+  in->d = new_vreg();
+  in->var = var;
+  in->imm = offset;
+  return in->d;
+}
+
+// Expressions are lowered in post-order with an explicit stack of
+// frames rather than by recursion, so that deeply nested ones cannot
+// overflow the native stack. A frame lowers the operands of its node
+// one at a time, collecting their registers, and then emits the
+// node's own instructions.
+typedef struct {
+  Node* node;
+  Node* ops[2];   // Operands to lower, in order
+  int   vals[2];  // and the registers holding them
+  int   nops;
+  int   done;     // Number of operands (or arguments) lowered
+  IrOp  op;       // Operator of an arithmetic node
+  long  scale;    // by which its right-hand side is multiplied
+  long  offset;   // Byte offset of a load or store
+  Node* arg;      // Next argument of a call to lower
+  int*  args;
+  int   nargs;
+} Frame;
+
+static _Thread_local Frame* frames;
+static _Thread_local int    nframes;
+static _Thread_local int    frames_cap;
+
+static void add_operand(Frame* f, Node* node) {
+  f->ops[f->nops++] = node;
+}
+
+// Computes `lhs op rhs`, where rhs is scaled by `scale`. A constant
+// right-hand side becomes the instruction's immediate.
+static void binary_operands(Frame* f, IrOp op, int scale) {
+  f->op = op;
+  f->scale = scale;
+  add_operand(f, f->node->lhs);
+  if (!is_imm(f->node->rhs, scale))
+    add_operand(f, f->node->rhs);
+}
+
+// Splits the address of a dereference into a base register and a
+// constant byte offset, so that `*(p+k)` becomes one instruction.
+static void deref_operand(Frame* f, Node* addr) {
+  if (addr->kind == ND_PTR_ADD && is_imm(addr->rhs, addr->ty->base->size)) {
+    f->offset = addr->rhs->val * addr->ty->base->size;
+    add_operand(f, addr->lhs);
+    return;
+  }
+  add_operand(f, addr);
+}
+
+static void push_frame(Node* node) {
+  if (nframes == frames_cap) {
+    frames_cap = frames_cap ? frames_cap * 2 : 64;
+    frames = realloc(frames, frames_cap * sizeof(Frame));
+  }
+  Frame* f = &frames[nframes++];
+  *f = (Frame){ .node = node };
+
+  switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return;
+    case ND_ADDR:
+      if (node->lhs->kind == ND_DEREF)
+        add_operand(f, node->lhs->lhs);
+      else if (node->lhs->kind != ND_VAR)
+        error_tok(node->lhs->tok, "not an lvalue");
+      return;
+    case ND_DEREF:
+      if (node->ty->kind == TY_ARRAY)
+        add_operand(f, node->lhs);
+      else
+        deref_operand(f, node->lhs);
+      return;
+    case ND_ASSIGN: {
+      Node* lhs = node->lhs;
+      if (lhs->ty->kind == TY_ARRAY)
+        error_tok(lhs->tok, "not an lvalue");
+      if (lhs->kind == ND_DEREF)
+        deref_operand(f, lhs->lhs);
+      else if (lhs->kind != ND_VAR)
+        error_tok(lhs->tok, "not an lvalue");
+      add_operand(f, node->rhs);
+      return;
+    }
+    case ND_FUNCALL:
+      for (Node* arg = node->args; arg; arg = arg->next)
+        f->nargs++;
+      f->args = region_alloc(MEM_IR, f->nargs * sizeof(int));
+      f->arg = node->args;
+      return;
+    case ND_ADD:
+      binary_operands(f, IR_ADD, 1);
+      return;
+    case ND_SUB:
+      // 0-x, the way the parser represents -x
+      if (node->lhs->kind == ND_NUM && node->lhs->val == 0) {
+        f->op = IR_NEG;
+        add_operand(f, node->rhs);
+        return;
+      }
+      binary_operands(f, IR_SUB, 1);
+      return;
+    case ND_PTR_ADD:
+      binary_operands(f, IR_ADD, node->ty->base->size);
+      return;
+    case ND_PTR_SUB:
+      binary_operands(f, IR_SUB, node->ty->base->size);
+      return;
+    case ND_PTR_DIFF:
+      binary_operands(f, IR_SUB, 1);
+      return;
+    case ND_MUL:
+      binary_operands(f, IR_MUL, 1);
+      return;
+    case ND_DIV:
+      binary_operands(f, IR_DIV, 1);
+      return;
+    case ND_EQ:
+      binary_operands(f, IR_EQ, 1);
+      return;
+    case ND_NE:
+      binary_operands(f, IR_NE, 1);
+      return;
+    case ND_LT:
+      binary_operands(f, IR_LT, 1);
+      return;
+    case ND_LE:
+      binary_operands(f, IR_LE, 1);
+      return;
+  }
+  error_tok(node->tok, "invalid expression");
+}
+
+// Emits a node whose operands have been lowered and returns the
+// register that holds its value.
+static int finish_frame(Frame* f) {
+  Node* node = f->node;
+
+  switch (node->kind) {
+    case ND_NUM:
+      return emit_def(IR_IMM, 0, 0, node->val);
+    case ND_VAR:
+      if (node->ty->kind == TY_ARRAY)
+        return emit_var(IR_ADDR, node->var, node->val);
+      return emit_var(IR_LOADV, node->var, node->val);
+    case ND_ADDR:
+      if (node->lhs->kind == ND_VAR)
+        return emit_var(IR_ADDR, node->lhs->var, node->lhs->val);
+      return f->vals[0];
+    case ND_DEREF:
+      if (node->ty->kind == TY_ARRAY)
+        return f->vals[0];
+      return emit_def(IR_LOAD, f->vals[0], 0, f->offset);
+    case ND_ASSIGN: {
+      Node* lhs = node->lhs;
+      if (lhs->kind == ND_VAR) {
+        IrInst* in = new_inst(IR_STOREV);
+        in->a = f->vals[0];
+        in->var = lhs->var;
+        in->imm = lhs->val;
+        return f->vals[0];
+      }
+      IrInst* in = new_inst(IR_STORE);
+      in->a = f->vals[0];
+      in->b = f->vals[1];
+      in->imm = f->offset;
+      return f->vals[1];
+    }
+    case ND_FUNCALL: {
+      IrInst* in = new_inst(IR_CALL);
+      in->d = new_vreg();
+      in->funcsym = node->funcsym;
+      in->args = f->args;
+      in->nargs = f->nargs;
+      return in->d;
+    }
+  }
+
+  if (f->op == IR_NEG)
+    return emit_def(IR_NEG, f->vals[0], 0, 0);
+
+  int val;
+  if (f->nops == 1) {
+    val = emit_def(f->op, f->vals[0], 0, node->rhs->val * f->scale);
+  } else {
+    int b = f->vals[1];
+    if (f->scale != 1)
+      b = emit_def(IR_MUL, b, 0, f->scale);
+    val = emit_def(f->op, f->vals[0], b, 0);
+  }
+
+  if (node->kind == ND_PTR_DIFF)
+    return emit_def(IR_DIV, val, 0, node->lhs->ty->base->size);
+  return val;
+}
+
+// Lowers an expression and returns the virtual register that holds
+// its value.
+static int lower_expr(Node* node) {
+  int base = nframes;
+  push_frame(node);
+
+  for (;;) {
+    Frame* f = &frames[nframes - 1];
+    if (f->arg) {
+      Node* arg = f->arg;
+      f->arg = arg->next;
+      push_frame(arg);
+      continue;
+    }
+    if (f->done < f->nops) {
+      push_frame(f->ops[f->done]);
+      continue;
+    }
+
+    int val = finish_frame(f);
+    if (--nframes == base)
+      return val;
+
+    Frame* parent = &frames[nframes - 1];
+    if (parent->node->kind == ND_FUNCALL)
+      parent->args[parent->done++] = val;
+    else
+      parent->vals[parent->done++] = val;
+  }
+}
+
+static void emit_br(Node* cond, BasicBlock* then, BasicBlock* els) {
+  int val = lower_expr(cond);
+  IrInst* in = new_inst(IR_BR);
+  in->a = val;
+  in->then = then;
+  in->els = els;
+}
+
+static void lower_stmt(Node* node) {
+  switch (node->kind) {
+    case ND_NULL:
+      return;
+    case ND_EXPR_STMT:
+      lower_expr(node->lhs);
+      return;
+    case ND_RETURN: {
+      int val = lower_expr(node->lhs);
+      new_inst(IR_RET)->a = val;
+      // Code after a return goes into a new, unreachable block.
+      start_bb(new_bb());
+      return;
+    }
+    case ND_IF: {
+      BasicBlock* then = new_bb();
+      BasicBlock* els = node->els ? new_bb() : NULL;
+      BasicBlock* end = new_bb();
+      emit_br(node->cond, then, els ? els : end);
+      start_bb(then);
+      lower_stmt(node->then);
+      if (els) {
+        emit_jmp(end);
+        start_bb(els);
+        lower_stmt(node->els);
+      }
+      start_bb(end);
+      return;
+    }
+    case ND_WHILE: {
+      BasicBlock* begin = new_bb();
+      BasicBlock* body = new_bb();
+      BasicBlock* end = new_bb();
+      start_bb(begin);
+      emit_br(node->cond, body, end);
+      start_bb(body);
+      lower_stmt(node->then);
+      emit_jmp(begin);
+      start_bb(end);
+      return;
+    }
+    case ND_FOR: {
+      BasicBlock* begin = new_bb();
+      BasicBlock* body = new_bb();
+      BasicBlock* end = new_bb();
+      if (node->init)
+        lower_stmt(node->init);
+      start_bb(begin);
+      if (node->cond)
+        emit_br(node->cond, body, end);
+      start_bb(body);
+      lower_stmt(node->then);
+      if (node->inc)
+        lower_stmt(node->inc);
+      emit_jmp(begin);
+      start_bb(end);
+      return;
+    }
+    case ND_BLOCK:
+      for (Node* n = node->block; n; n = n->next)
+        lower_stmt(n);
+      return;
+  }
+  error_tok(node->tok, "invalid statement");
+}
+
+static void lower_function(Function* f) {
+  fn = f;
+  cur_bb = last_bb = NULL;
+  nblocks = 0;
+
+  start_bb(new_bb());
+  for (Node* n = fn->node; n; n = n->next)
+    lower_stmt(n);
+  if (!is_terminated(cur_bb))
+    new_inst(IR_RET);
+}
+
+// Empties the frame stack an error may have left behind.
+void reset_lowering(void) {
+  nframes = 0;
+}
+
+void lower(Program* prog) {
+  for (Function* f = prog->fns; f; f = f->next)
+    if (!f->cached)
+      lower_function(f);
+}
+
+//
+// IR dump
+//
+
+static char* op_names[] = {
+  [IR_IMM] = "imm", [IR_NEG] = "neg", [IR_ADD] = "add", [IR_SUB] = "sub",
+  [IR_MUL] = "mul", [IR_DIV] = "div", [IR_EQ] = "eq", [IR_NE] = "ne",
+  [IR_LT] = "lt", [IR_LE] = "le", [IR_ADDR] = "addr", [IR_LOADV] = "load",
+  [IR_STOREV] = "store", [IR_LOAD] = "load", [IR_STORE] = "store",
+  [IR_CALL] = "call", [IR_JMP] = "jmp", [IR_BR] = "br", [IR_RET] = "ret",
+};
+
+static void dump_offset(Buf* out, long offset) {
+  if (offset > 0)
+    buf_putc(out, '+');
+  if (offset)
+    buf_putint(out, offset);
+}
+
+static void dump_inst(Buf* out, IrInst* in) {
+  buf_puts(out, "  ");
+  if (in->d)
+    buf_printf(out, "v%d = ", in->d);
+  buf_puts(out, op_names[in->op]);
+
+  switch (in->op) {
+    case IR_IMM:
+      buf_printf(out, " %ld", in->imm);
+      break;
+    case IR_NEG:
+      buf_printf(out, " v%d", in->a);
+      break;
+    case IR_ADD:
+    case IR_SUB:
+    case IR_MUL:
+    case IR_DIV:
+    case IR_EQ:
+    case IR_NE:
+    case IR_LT:
+    case IR_LE:
+      if (in->b)
+        buf_printf(out, " v%d, v%d", in->a, in->b);
+      else
+        buf_printf(out, " v%d, %ld", in->a, in->imm);
+      break;
+    case IR_ADDR:
+    case IR_LOADV:
+      buf_printf(out, " %s", sym_name(in->var->sym));
+      dump_offset(out, in->imm);
+      break;
+    case IR_STOREV:
+      buf_printf(out, " %s", sym_name(in->var->sym));
+      dump_offset(out, in->imm);
+      buf_printf(out, ", v%d", in->a);
+      break;
+    case IR_LOAD:
+      buf_printf(out, " [v%d", in->a);
+      dump_offset(out, in->imm);
+      buf_putc(out, ']');
+      break;
+    case IR_STORE:
+      buf_printf(out, " [v%d", in->a);
+      dump_offset(out, in->imm);
+      buf_printf(out, "], v%d", in->b);
+      break;
+    case IR_CALL:
+      buf_printf(out, " %s(", sym_name(in->funcsym));
+      for (int i = 0; i < in->nargs; i++)
+        buf_printf(out, i ? ", v%d" : "v%d", in->args[i]);
+      buf_putc(out, ')');
+      break;
+    case IR_JMP:
+      buf_printf(out, " bb%d", in->then->id);
+      break;
+    case IR_BR:
+      buf_printf(out, " v%d, bb%d, bb%d", in->a, in->then->id, in->els->id);
+      break;
+    case IR_RET:
+      if (in->a)
+        buf_printf(out, " v%d", in->a);
+      break;
+  }
+  buf_putc(out, '\n');
+}
+
+// Prints the lowered program in a human-readable form.
+void dump_ir(Program* prog, Buf* out) {
+  for (Function* f = prog->fns; f; f = f->next) {
+    buf_printf(out, "%s(", sym_name(f->sym));
+    for (VarList* vl = f->params; vl; vl = vl->next)
+      buf_printf(out, vl == f->params ? "%s" : ", %s", sym_name(vl->var->sym));
+    buf_puts(out, "):\n");
+
+    for (BasicBlock* bb = f->bbs; bb; bb = bb->next) {
+      buf_printf(out, "bb%d:\n", bb->id);
+      for (IrInst* in = bb->insts; in; in = in->next)
+        dump_inst(out, in);
+    }
+  }
+}
@@ -0,0 +1,128 @@
+#include "litecc.h"
+
+// In-process execution of compiled code.
+//
+// Instead of writing an object file, the code assembled by asm.c is
+// copied into an anonymous mapping, relocated against the addresses
+// it actually landed at and run by calling `main` directly. Calls
+// to functions that are not defined in the program are resolved
+// with dlsym() in the running process, which includes any shared
+// objects loaded with --load.
+//
+// The layout of the mapping is:
+//
+//   code    .text of the program
+//   stubs   `jmp [rip+0]; .quad addr` for external functions that
+//           are too far away for a 32-bit call displacement
+//   data    global variables, on their own pages
+//
+// Code and stubs are made read-only and executable before running.
+
+#define STUB_SIZE 16
+
+static size_t align_up(size_t n, size_t align) {
+  return (n + align - 1) / align * align;
+}
+
+static bool fits_rel32(long val) {
+  return val == (int)val;
+}
+
+typedef struct {
+  char*   mem;
+  size_t  stub_off;  // Next free stub
+  HashMap addrs;     // Symbol ID -> address
+  HashMap stubs;     // Symbol ID -> stub address
+} Image;
+
+// Returns the address a call to `sym` at `place` should go to.
+static char* resolve_call(Image* img, int sym, char* place) {
+  char* addr = hashmap_get(&img->addrs, sym);
+  if (addr)
+    return addr;
+
+  addr = dlsym(RTLD_DEFAULT, sym_name(sym));
+  if (!addr)
+    error("undefined reference to `%s'", sym_name(sym));
+  if (fits_rel32(addr - place))
+    return addr;
+
+  char* stub = hashmap_get(&img->stubs, sym);
+  if (stub)
+    return stub;
+
+  stub = img->mem + img->stub_off;
+  img->stub_off += STUB_SIZE;
+  memcpy(stub, "\xff\x25\0\0\0\0", 6);
+  memcpy(stub + 6, &addr, 8);
+  hashmap_put(&img->stubs, sym, stub);
+  return stub;
+}
+
+// Loads the assembled program into memory and runs its main
+// function. Returns main's return value.
+int jit_run(Object* obj, VarList* globals) {
+  size_t page = sysconf(_SC_PAGESIZE);
+
+  long data_size = 0;
+  for (VarList* vl = globals; vl; vl = vl->next)
+    data_size += vl->var->ty->size;
+
+  // Reserve a stub for every call in the worst case.
+  size_t ncalls = 0;
+  for (int i = 0; i < obj->nrelocs; i++)
+    if (obj->relocs[i].type == R_X86_64_PLT32)
+      ncalls++;
+
+  size_t stub_start = align_up(obj->text.len, STUB_SIZE);
+  size_t code_size = align_up(stub_start + ncalls * STUB_SIZE, page);
+  size_t size = code_size + align_up(data_size, page);
+
+  Image img = {};
+  img.mem = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (img.mem == MAP_FAILED)
+    error("cannot map memory: %s", strerror(errno));
+  img.stub_off = stub_start;
+  if (obj->text.len)
+    memcpy(img.mem, obj->text.data, obj->text.len);
+
+  for (int i = 0; i < obj->nfuncs; i++)
+    hashmap_put(&img.addrs, obj->funcs[i].sym, img.mem + obj->funcs[i].offset);
+
+  char* data = img.mem + code_size;
+  for (VarList* vl = globals; vl; vl = vl->next) {
+    hashmap_put(&img.addrs, vl->var->sym, data);
+    data += vl->var->ty->size;
+  }
+
+  for (int i = 0; i < obj->nrelocs; i++) {
+    Reloc* r = &obj->relocs[i];
+    char* place = img.mem + r->offset;
+    char* target;
+
+    if (r->type == R_X86_64_PLT32)
+      target = resolve_call(&img, r->sym, place);
+    else
+      target = hashmap_get(&img.addrs, r->sym);
+    if (!target)
+      error("undefined reference to `%s'", sym_name(r->sym));
+
+    long val = target + r->addend - place;
+    if (!fits_rel32(val))
+      error("internal error: relocation out of range: %s", sym_name(r->sym));
+    int32_t rel = val;
+    memcpy(place, &rel, 4);
+  }
+
+  if (mprotect(img.mem, code_size, PROT_READ | PROT_EXEC) == -1)
+    error("cannot map memory: %s", strerror(errno));
+
+  long (*main_fn)(void) = hashmap_get(&img.addrs, intern("main", 4));
+  if (!main_fn)
+    error("undefined reference to `main'");
+
+  free(img.addrs.buckets);
+  free(img.stubs.buckets);
+  return main_fn();
+}
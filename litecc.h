@@ -1,11 +1,29 @@
 #define _GNU_SOURCE
 #include <assert.h>
 #include <ctype.h>
+#include <dirent.h>
+#include <dlfcn.h>
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <malloc.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdnoreturn.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
 
 // Debug utils.
 #ifdef DEBUG
@@ -15,6 +33,78 @@
 #endif
 
 typedef struct Type Type;
+typedef struct BasicBlock BasicBlock;
+
+//
+// main.c
+//
+
+extern int  opt_O;
+extern int  opt_jobs;
+extern bool opt_peephole;
+extern bool opt_peephole_stats;
+extern bool opt_dump_ir;
+
+//
+// region.c
+//
+
+// Categories of memory, counted separately in the statistics.
+typedef enum {
+  MEM_TOKENS,
+  MEM_NAMES,  // Interned identifiers, which outlive compilations
+  MEM_NODES,
+  MEM_VARS,   // Variables and variable lists
+  MEM_TYPES,
+  MEM_FUNCS,  // Functions and programs
+  MEM_IR,
+  NUM_MEM,
+} MemKind;
+
+void* region_alloc(MemKind kind, size_t size);
+void* region_realloc(MemKind kind, void* p, size_t old_size, size_t new_size);
+void  region_free(void);
+
+//
+// stats.c
+//
+
+typedef enum {
+  PH_READ,      // Reading the source
+  PH_TOKENIZE,  // tokenize()
+  PH_PARSE,     // program(), including typing
+  PH_FOLD,      // fold()
+  PH_DCE,       // eliminate_dead_code()
+  PH_FRAME,     // Stack offset assignment
+  PH_LOWER,     // lower()
+  PH_CODEGEN,   // Instruction selection through assembly printing or
+                // machine code encoding, per function and in parallel
+  PH_EMIT,      // Joining the functions' code; writing ELF or IR
+  PH_WRITE,     // Writing the output
+  NUM_PHASES,
+} Phase;
+
+typedef struct {
+  long tokens;
+  long nodes;
+  long types;
+  long vars;
+  long ir_insts;
+  long insts;
+  long mem_bytes[NUM_MEM];    // Bytes allocated per category
+  long mem_objects[NUM_MEM];  // Objects allocated per category
+} Stats;
+
+extern bool                stats_enabled;
+extern _Thread_local Stats stats;
+
+void   phase_begin(Phase ph);
+void   phase_end(void);
+void   reset_phases(void);
+double thread_cpu_seconds(void);
+void   phase_add_cpu(Phase ph, double secs);
+void   stats_flush(void);
+void print_stats(FILE* out, bool json);
 
 //
 // tokenize.c
@@ -27,30 +117,127 @@ typedef enum {
   TK_EOF,        // End-of-file markers
 } TokenKind;
 
-typedef struct Token Token;
-struct Token {
-  TokenKind kind;  // Token kind
-  long val;        // If kind is TK_NUM, its value
-  char* str;       // Token string
-  int len;         // Token length
-  Token* next;     // Next token
-};
+// Keyword and punctuator IDs of TK_RESERVED tokens.
+typedef enum {
+  TOK_NONE,
+  // Keywords
+  TOK_RETURN,    // "return"
+  TOK_IF,        // "if"
+  TOK_ELSE,      // "else"
+  TOK_WHILE,     // "while"
+  TOK_FOR,       // "for"
+  TOK_INT,       // "int"
+  TOK_SIZEOF,    // "sizeof"
+  // Punctuators
+  TOK_EQ,        // ==
+  TOK_NE,        // !=
+  TOK_LE,        // <=
+  TOK_GE,        // >=
+  TOK_LT,        // <
+  TOK_GT,        // >
+  TOK_ASSIGN,    // =
+  TOK_PLUS,      // +
+  TOK_MINUS,     // -
+  TOK_STAR,      // *
+  TOK_SLASH,     // /
+  TOK_AMP,       // &
+  TOK_LPAREN,    // (
+  TOK_RPAREN,    // )
+  TOK_LBRACE,    // {
+  TOK_RBRACE,    // }
+  TOK_LBRACKET,  // [
+  TOK_RBRACKET,  // ]
+  TOK_SEMI,      // ;
+  TOK_COMMA,     // ,
+  TOK_PUNCT,     // Any other punctuation character
+} TokenId;
+
+// Tokens are kept in struct-of-arrays form and referred to by their
+// index. Index 0 is reserved so that 0 can mean "no token".
+typedef struct {
+  unsigned char* kind;  // Token kind
+  unsigned char* id;    // If kind is TK_RESERVED, its keyword or punctuator
+  int*  loc;            // Byte offset of the token string in user_input
+  int*  len;            // Token length
+  long* val;            // If kind is TK_NUM, its value. If kind is
+                        // TK_IDENT, its interned symbol ID
+  int   nr;             // Number of tokens
+  int   cap;            // Capacity of the arrays
+} TokenArray;
 
 void   dispaly_tokens(void);
-void   error(char *fmt, ...);
-void   error_at(char* loc, char* fmt, ...);
-void   error_tok(Token* tok, char* fmt, ...);
-Token *peek(char* s);
-Token *consume(char *op);
-Token *consume_ident(void);
-void   expect(char *op);
+noreturn void error(char *fmt, ...);
+noreturn void error_at(char* loc, char* fmt, ...);
+noreturn void error_tok(int tok, char* fmt, ...);
+char  *tok_str(int tok);
+int    peek(TokenId id);
+int    consume(TokenId id);
+int    consume_ident(void);
+void   expect(TokenId id);
 long   expect_number(void);
-char  *expect_ident(void);
+int    expect_ident(void);
 bool   at_eof(void);
-Token *tokenize(void);
+int    tokenize(void);
 
-extern char*  user_input;
-extern Token* token;
+// Per-compilation state. Files may be compiled on several threads
+// at once.
+extern _Thread_local char*      current_filename;
+extern _Thread_local char*      user_input;
+extern _Thread_local TokenArray tokens;
+extern _Thread_local int        token;
+extern _Thread_local jmp_buf*   error_jmp;
+
+//
+// intern.c
+//
+
+typedef struct SymTable SymTable;
+
+SymTable* intern_table(void);
+void      set_intern_table(SymTable* t);
+uint32_t  hash_string(char* str, int len);
+int       intern_hashed(char* str, int len, uint32_t hash);
+int       intern(char* str, int len);
+char     *sym_name(int sym);
+
+//
+// hashmap.c
+//
+
+typedef struct {
+  int   key;
+  void* val;
+} HashEntry;
+
+typedef struct {
+  HashEntry* buckets;
+  int        capacity;
+  int        used;
+} HashMap;
+
+void*  hashmap_get(HashMap* map, int key);
+void** hashmap_slot(HashMap* map, int key);
+void   hashmap_put(HashMap* map, int key, void* val);
+
+//
+// cache.c
+//
+
+typedef struct {
+  uint64_t h1;
+  uint64_t h2;
+} CacheKey;
+
+extern bool cache_enabled;
+
+void     cache_init(char* dir, long max_bytes);
+CacheKey cache_key(void);
+void     hash_bytes(CacheKey* key, void* p, size_t n);
+void     hash_long(CacheKey* key, long val);
+char    *cache_get(CacheKey* key);
+void     cache_put(CacheKey* key, char* text, size_t len);
+void     cache_evict(void);
+void     print_cache_stats(FILE* out);
 
 //
 // parse.c
@@ -59,12 +246,17 @@ extern Token* token;
 // Variable
 typedef struct Var Var;
 struct Var {
-  char* name;     // variable name
+  int   sym;      // variable name (symbol ID)
   Type* ty;       // type
   bool  is_local; // local or global
-  int   len;      // name length
   // Local variable
   int   offset;   // offset from rbp
+  bool  is_read;  // Read anywhere in the function (see dce.c)
+
+  // Symbol table
+  Var*  shadow;   // binding of the same name in an enclosing scope
+  int   depth;    // depth of the declaring scope
+  int   scope;    // ID of the declaring scope
 };
 
 typedef struct VarList VarList;
@@ -101,42 +293,75 @@ typedef enum {
 } NodeKind;
 
 // AST node type.
+//
+// A node is a common header followed by the fields of its kind. Only
+// the fields of the node's kind may be used, and a node is allocated
+// just large enough for them (see new_node()). A node may be turned
+// into one of another kind in place only if the new kind needs no
+// more space, e.g. an operator into ND_NUM or ND_VAR.
 typedef struct Node Node;
 struct Node {
   NodeKind kind;  // Node kind
-  Node* next;     // Next node
+  int   tok;      // Representative token
   Type* ty;       // Type, e.g. int or pointer to int
-  Token* tok;     // Representative token
-
-  Node* lhs;      // Left-hand side
-  Node* rhs;      // Right-hand side
-  
-  // "if", "while" or "for" statement
-  Node* cond;
-  Node* then;
-  Node* els;
-  Node* init;
-  Node* inc;
-
-  // Block
-  Node* block;
-
-  // Function Call
-  char* funcname;
-  Node* args;
-
-  Var*  var;      // Used if kind == ND_VAR
-  long  val;      // Used if kind == ND_NUM
+  Node* next;     // Next statement in a block, or next argument
+
+  union {
+    // Operators, "return" and expression statements. Unary
+    // operators leave `rhs` NULL.
+    struct {
+      Node* lhs;  // Left-hand side
+      Node* rhs;  // Right-hand side
+    };
+
+    // "if", "while" or "for" statement
+    struct {
+      Node* cond;
+      Node* then;
+      Node* els;
+      Node* init;
+      Node* inc;
+    };
+
+    // Block
+    struct {
+      Node*    block;
+      VarList* decls;  // Variables declared directly in the block
+    };
+
+    // Function call
+    struct {
+      Node* args;
+      int   funcsym;  // callee name (symbol ID)
+    };
+
+    // ND_VAR or ND_NUM
+    struct {
+      Var*  var;  // Used if kind == ND_VAR
+      long  val;  // Used if kind == ND_NUM, or the byte displacement
+                  // from `var` if kind == ND_VAR
+    };
+  };
 };
 
 typedef struct Function Function;
 struct Function {
   Function* next;
-  char*     name;
+  int       sym;        // function name (symbol ID)
   VarList*  params;
   Node*     node;
-  VarList*  locals;
+  VarList*  locals;     // All local variables, including parameters
+  VarList*  decls;      // Those declared outside of any block
   int       stack_size;
+
+  // Lowered form (see ir.c)
+  BasicBlock* bbs;
+  int         nvregs;   // Virtual registers are numbered 1..nvregs
+
+  // Function-level cache (see cache.c)
+  bool        cacheable;  // Whether `key` is set
+  CacheKey    key;
+  char*       cached;     // Assembly from the cache; the body is not parsed
 };
 
 typedef struct {
@@ -145,6 +370,7 @@ typedef struct {
 } Program;
 
 Program *program(void);
+void     reset_parser(void);
 
 //
 // typing.c
@@ -168,10 +394,240 @@ extern Type* int_type;
 bool  is_integer(Type *ty);
 Type* pointer_to(Type *base);
 Type* array_of(Type *base, int size);
+void  reset_types(void);
 void  add_type(Node* node);
 
+//
+// frame.c
+//
+
+void layout_frames(Program* prog);
+
+//
+// emit.c
+//
+
+typedef struct {
+  char*  data;
+  size_t len;
+  size_t cap;
+} Buf;
+
+void buf_putn(Buf* buf, char* s, size_t n);
+void buf_puts(Buf* buf, char* s);
+void buf_putc(Buf* buf, char c);
+void buf_putint(Buf* buf, long val);
+void buf_vprintf(Buf* buf, char* fmt, va_list ap);
+void buf_printf(Buf* buf, char* fmt, ...);
+void buf_write(Buf* buf, FILE* out);
+
+//
+// fold.c
+//
+
+void fold(Program* prog);
+bool is_pure(Node* node);
+
+//
+// dce.c
+//
+
+void eliminate_dead_code(Program* prog);
+
+//
+// ir.c
+//
+
+// Three-address instructions over virtual registers. Variables live
+// in memory and are accessed with explicit loads and stores, so a
+// virtual register is only ever used within the basic block that
+// defines it.
+typedef enum {
+  IR_IMM,     // d = imm
+  IR_NEG,     // d = -a
+  IR_ADD,     // d = a + b
+  IR_SUB,     // d = a - b
+  IR_MUL,     // d = a * b
+  IR_DIV,     // d = a / b
+  IR_EQ,      // d = a == b
+  IR_NE,      // d = a != b
+  IR_LT,      // d = a < b
+  IR_LE,      // d = a <= b
+  IR_ADDR,    // d = &var + imm
+  IR_LOADV,   // d = var at byte offset imm
+  IR_STOREV,  // var at byte offset imm = a
+  IR_LOAD,    // d = *(a + imm)
+  IR_STORE,   // *(a + imm) = b
+  IR_CALL,    // d = funcsym(args...)
+  IR_JMP,     // goto then
+  IR_BR,      // if (a) goto then; else goto els
+  IR_RET,     // return a, or just return if a is 0
+} IrOp;
+
+// For binary operators, b == 0 means that the right-hand side is
+// the constant `imm`.
+typedef struct IrInst IrInst;
+struct IrInst {
+  IrInst* next;
+  IrOp    op;
+  int     d, a, b;  // Virtual registers; 0 if unused
+  long    imm;
+  Var*    var;
+
+  // Function call
+  int     funcsym;
+  int*    args;
+  int     nargs;
+
+  // Branch targets
+  BasicBlock* then;
+  BasicBlock* els;
+};
+
+struct BasicBlock {
+  BasicBlock* next;
+  int         id;
+  IrInst*     insts;
+  IrInst*     last;
+};
+
+void lower(Program* prog);
+void reset_lowering(void);
+void dump_ir(Program* prog, Buf* out);
+
+//
+// x86.c
+//
+
+// Registers, numbered as in instruction encodings.
+typedef enum {
+  RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+  R8, R9, R10, R11, R12, R13, R14, R15,
+  RIP,
+} Reg;
+
+typedef enum {
+  OPR_NONE,
+  OPR_REG,    // Register
+  OPR_IMM,    // Immediate
+  OPR_MEM,    // Memory at [reg+val], or [rip+sym+val] if reg is RIP
+  OPR_LABEL,  // Local label number val
+  OPR_SYM,    // Symbol
+} OperandKind;
+
+typedef struct {
+  unsigned char kind;  // OperandKind
+  unsigned char reg;   // Reg
+  int  sym;            // Symbol ID
+  long val;            // Immediate, displacement or label number
+} Operand;
+
+typedef enum {
+  I_NOP,    // Deleted instruction
+  I_LABEL,  // Label definition; a is the label
+  I_MOV,
+  I_LEA,
+  I_ADD,
+  I_SUB,
+  I_IMUL,   // imul a, b or imul a, b, c
+  I_IDIV,
+  I_CQO,
+  I_NEG,
+  I_AND,
+  I_CMP,
+  I_SETCC,  // set<cc> al
+  I_MOVZB,  // movzx a, al
+  I_PUSH,
+  I_POP,
+  I_JMP,
+  I_JCC,    // j<cc> a
+  I_CALL,
+  I_RET,
+} InstKind;
+
+typedef enum {
+  CC_E, CC_NE, CC_L, CC_LE, CC_G, CC_GE,
+} CondCode;
+
+typedef struct {
+  unsigned char kind;  // InstKind
+  unsigned char cc;    // CondCode of I_SETCC and I_JCC
+  Operand a, b, c;
+} Inst;
+
+typedef struct {
+  Inst* data;
+  int   len;
+  int   cap;
+} InstList;
+
+Operand  op_reg(Reg reg);
+Operand  op_imm(long val);
+Operand  op_mem(Reg base, long disp);
+Operand  op_rip(int sym, long disp);
+Operand  op_label(int label);
+Operand  op_sym(int sym);
+Inst    *inst_add(InstList* list, InstKind kind, Operand a, Operand b);
+bool     is_imm32(long val);
+CondCode negate_cc(CondCode cc);
+void     print_insts(Buf* buf, int fn, InstList* list);
+
+//
+// peephole.c
+//
+
+void peephole(InstList* list);
+void print_peephole_stats(FILE* out);
+
+//
+// elf.c
+//
+
+typedef struct {
+  long offset;  // Offset in .text
+  int  sym;     // Target symbol ID
+  int  type;    // R_X86_64_*
+  long addend;
+} Reloc;
+
+typedef struct {
+  int  sym;     // Symbol ID
+  long offset;  // Offset in .text
+  long size;
+} FuncSym;
+
+// A relocatable object file being built.
+typedef struct {
+  Buf      text;
+  Reloc*   relocs;
+  int      nrelocs;
+  int      relocs_cap;
+  FuncSym* funcs;
+  int      nfuncs;
+  int      funcs_cap;
+} Object;
+
+void obj_add_reloc(Object* obj, long offset, int sym, int type, long addend);
+void obj_add_func(Object* obj, int sym, long offset, long size);
+void obj_append(Object* dst, Object* src);
+void obj_free(Object* obj);
+void write_elf(Object* obj, VarList* globals, Buf* out);
+
+//
+// asm.c
+//
+
+void assemble(Object* obj, int sym, InstList* list);
+
+//
+// jit.c
+//
+
+int jit_run(Object* obj, VarList* globals);
+
 //
 // codegen.c
 //
 
-void codegen(Program* prog);
\ No newline at end of file
+void codegen(Program* prog, Buf* out);
+void codegen_object(Program* prog, Object* obj);
\ No newline at end of file
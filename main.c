@@ -1,31 +1,585 @@
-#include "litecc.h"
-
-int main(int argc, char **argv) {
-  if (argc != 2) {
-    error("%s invalid number of arguments", argv[0]);
-  }
-  
-  user_input = argv[1];
-  
-  // Scanner
-  token = tokenize();
-  
-  // Parser
-  Program* prog = program();
-
-  // Assign offsets to local variables.
-  for (Function* fn = prog->fns; fn != NULL; fn = fn->next) {
-    int offset = 0;
-    for (VarList* vl = fn->locals; vl != NULL; vl = vl->next) {
-      Var* var = vl->var;
-      offset += var->ty->size;
-      var->offset = offset;
-    }
-    fn->stack_size = offset;
-  }
-
-  // Traverse the AST to emit assembly.
-  codegen(prog);
-
-  return 0;
-}
\ No newline at end of file
+#include "litecc.h"
+
+static char** input_paths;
+static int    ninputs;
+static char* output_path;
+static bool  opt_fsyntax_only;
+static bool  opt_c;
+static bool  opt_run;
+static bool  opt_batch;
+static bool  opt_time_report;
+static char* opt_stats_path;
+static char* opt_cache_dir;
+static long  opt_cache_size = 64;  // MiB
+static bool  opt_cache_stats;
+
+int  opt_O = 1;
+int  opt_jobs;
+bool opt_peephole = true;
+bool opt_peephole_stats;
+bool opt_dump_ir;
+
+static void usage(int status) {
+  fprintf(stderr, "litecc [ -o <path> ] [ -c | -S ] [ -O<level> ] [ -f[no-]peephole ]\n"
+                  "       [ --peephole-stats ] [ --dump-ir ] [ -fsyntax-only ]\n"
+                  "       [ --run [ --load <lib.so> ]... ] [ --batch ]\n"
+                  "       [ --time-report ] [ --stats=<path> ] [ -j <threads> ]\n"
+                  "       [ --cache-dir=<dir> [ --cache-size=<MiB> ] [ --cache-stats ] ]\n"
+                  "       <file>...\n");
+  exit(status);
+}
+
+static void parse_args(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--help"))
+      usage(0);
+
+    if (!strcmp(argv[i], "-fsyntax-only")) {
+      opt_fsyntax_only = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-O0") || !strcmp(argv[i], "-O1") ||
+        !strcmp(argv[i], "-O")) {
+      opt_O = argv[i][2] ? argv[i][2] - '0' : 1;
+      opt_peephole = opt_O > 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fpeephole")) {
+      opt_peephole = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-peephole")) {
+      opt_peephole = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--peephole-stats")) {
+      opt_peephole_stats = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-S")) {
+      opt_c = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--run")) {
+      opt_run = true;
+      continue;
+    }
+
+    // Make a shared object's symbols available to --run.
+    if (!strcmp(argv[i], "--load")) {
+      if (++i == argc)
+        usage(1);
+      if (!dlopen(argv[i], RTLD_NOW | RTLD_GLOBAL))
+        error("%s", dlerror());
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--batch")) {
+      opt_batch = true;
+      continue;
+    }
+
+    // Report time and memory use per phase on stderr.
+    if (!strcmp(argv[i], "--time-report")) {
+      opt_time_report = true;
+      continue;
+    }
+
+    // Write the same report as JSON to a file.
+    if (!strncmp(argv[i], "--stats=", 8)) {
+      opt_stats_path = argv[i] + 8;
+      continue;
+    }
+
+    // Reuse the assembly of unchanged functions from earlier runs.
+    if (!strncmp(argv[i], "--cache-dir=", 12)) {
+      opt_cache_dir = argv[i] + 12;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "--cache-size=", 13)) {
+      opt_cache_size = atol(argv[i] + 13);
+      if (opt_cache_size < 1)
+        error("invalid cache size: %s", argv[i] + 13);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--cache-stats")) {
+      opt_cache_stats = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--dump-ir")) {
+      opt_dump_ir = true;
+      continue;
+    }
+
+    // Number of threads to generate code on.
+    if (!strcmp(argv[i], "-j")) {
+      if (++i == argc)
+        usage(1);
+      opt_jobs = atoi(argv[i]);
+      if (opt_jobs < 1)
+        error("invalid number of threads: %s", argv[i]);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (++i == argc)
+        usage(1);
+      output_path = argv[i];
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-o", 2)) {
+      output_path = argv[i] + 2;
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1] != '\0')
+      error("unknown argument: %s", argv[i]);
+
+    input_paths = realloc(input_paths, sizeof(char*) * (ninputs + 1));
+    input_paths[ninputs++] = argv[i];
+  }
+
+  if (ninputs == 0)
+    error("no input files");
+  if (ninputs > 1 && output_path)
+    error("cannot specify -o with multiple input files");
+  for (int i = 0; ninputs > 1 && i < ninputs; i++)
+    if (!strcmp(input_paths[i], "-"))
+      error("cannot read standard input with multiple input files");
+  if (ninputs > 1 && (opt_run || opt_batch))
+    error("--run and --batch take a single input file");
+  stats_enabled = opt_time_report || opt_stats_path;
+  // The cache holds assembly text, so it only applies when that is
+  // the output.
+  if (opt_cache_dir && !opt_c && !opt_run && !opt_batch && !opt_dump_ir &&
+      !opt_fsyntax_only)
+    cache_init(opt_cache_dir, opt_cache_size << 20);
+
+  if (!opt_jobs)
+    opt_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  if (opt_jobs < 1)
+    opt_jobs = 1;
+}
+
+// Reads a whole stream into a NUL-terminated buffer. Used for
+// stdin and other inputs that cannot be mapped.
+static char* read_stream(FILE* fp) {
+  size_t cap = 4096;
+  size_t len = 0;
+  char* buf = malloc(cap);
+
+  for (;;) {
+    if (cap - len < 4096) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    size_t n = fread(buf + len, 1, cap - len - 1, fp);
+    if (n == 0)
+      break;
+    len += n;
+  }
+
+  if (ferror(fp))
+    error("cannot read %s: %s", current_filename, strerror(errno));
+  buf[len] = '\0';
+  return buf;
+}
+
+// Size of the mapping that read_file() last returned on this thread,
+// or 0 if it returned a malloc'd buffer.
+static _Thread_local size_t mapped_size;
+
+// Maps a source file read-only. The tokenizer relies on a
+// terminating NUL, so we first reserve a zero-filled anonymous
+// region at least one byte longer than the file and then map the
+// file over its head. The bytes after the end of the file are
+// therefore always zero, and no copy of the source is made.
+static char* read_file(char* path) {
+  mapped_size = 0;
+  if (!strcmp(path, "-"))
+    return read_stream(stdin);
+
+  int fd = open(path, O_RDONLY);
+  if (fd == -1)
+    error("cannot open %s: %s", path, strerror(errno));
+
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+    error("cannot stat %s: %s", path, strerror(errno));
+
+  // Pipes, character devices and the like cannot be mapped.
+  if (!S_ISREG(st.st_mode)) {
+    FILE* fp = fdopen(fd, "r");
+    char* buf = read_stream(fp);
+    fclose(fp);
+    return buf;
+  }
+
+  size_t size = st.st_size;
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t reserve = (size / page + 1) * page;
+
+  char* buf = mmap(NULL, reserve, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buf == MAP_FAILED)
+    error("cannot map %s: %s", path, strerror(errno));
+
+  if (size > 0 &&
+      mmap(buf, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    error("cannot map %s: %s", path, strerror(errno));
+
+  close(fd);
+  mapped_size = reserve;
+  return buf;
+}
+
+// Releases a buffer returned by read_file().
+static void close_file(char* buf) {
+  if (mapped_size)
+    munmap(buf, mapped_size);
+  else
+    free(buf);
+}
+
+static FILE* open_file(char* path) {
+  if (!path || !strcmp(path, "-"))
+    return stdout;
+
+  FILE* out = fopen(path, "w");
+  if (!out)
+    error("cannot open output file: %s: %s", path, strerror(errno));
+  return out;
+}
+
+// Returns the next snippet of batch input as a NUL-terminated copy
+// and advances `*p` past it. Snippets are separated by lines that
+// consist of just "%%".
+static char* next_snippet(char** p) {
+  char* start = *p;
+  for (char* line = start;;) {
+    char* eol = strchr(line, '\n');
+    char* end = eol ? eol : line + strlen(line);
+
+    if (end - line == 2 && !strncmp(line, "%%", 2)) {
+      *p = eol ? eol + 1 : end;
+      return strndup(start, line - start);
+    }
+    if (!eol) {
+      *p = end;
+      return strndup(start, end - start);
+    }
+    line = eol + 1;
+  }
+}
+
+// Gives the functions and global variables of the `index`-th batch
+// snippet names of the form _c<index>_<name>, so that all snippets
+// can be linked into one program.
+static void prefix_symbols(Program* prog, int index) {
+  char prefix[32];
+  snprintf(prefix, sizeof(prefix), "_c%d_", index);
+  HashMap renamed = {};
+
+  for (Function* fn = prog->fns; fn; fn = fn->next) {
+    char* name = sym_name(fn->sym);
+    char* buf = malloc(strlen(prefix) + strlen(name) + 1);
+    int sym = intern(buf, sprintf(buf, "%s%s", prefix, name));
+    free(buf);
+    hashmap_put(&renamed, fn->sym, (void*)(long)sym);
+    fn->sym = sym;
+  }
+
+  for (VarList* vl = prog->globals; vl; vl = vl->next) {
+    char* name = sym_name(vl->var->sym);
+    char* buf = malloc(strlen(prefix) + strlen(name) + 1);
+    vl->var->sym = intern(buf, sprintf(buf, "%s%s", prefix, name));
+    free(buf);
+  }
+
+  // Calls to functions defined elsewhere keep their names.
+  for (Function* fn = prog->fns; fn; fn = fn->next) {
+    for (BasicBlock* bb = fn->bbs; bb; bb = bb->next) {
+      for (IrInst* in = bb->insts; in; in = in->next) {
+        int sym;
+        if (in->op == IR_CALL &&
+            (sym = (long)hashmap_get(&renamed, in->funcsym)) != 0)
+          in->funcsym = sym;
+      }
+    }
+  }
+  free(renamed.buckets);
+}
+
+// Compiles `user_input` down to three-address code. Returns NULL if
+// only the syntax is to be checked.
+static Program* compile(void) {
+  // Scanner
+  phase_begin(PH_TOKENIZE);
+  token = tokenize();
+  stats.tokens += tokens.nr - 2;  // Minus index 0 and TK_EOF
+  phase_end();
+
+  // Parser
+  phase_begin(PH_PARSE);
+  Program* prog = program();
+  phase_end();
+  if (opt_fsyntax_only)
+    return NULL;
+
+  // Simplify constant expressions.
+  phase_begin(PH_FOLD);
+  fold(prog);
+  phase_end();
+
+  // Remove unreachable statements, statements without effect and
+  // unread variables.
+  phase_begin(PH_DCE);
+  eliminate_dead_code(prog);
+  phase_end();
+
+  // Assign offsets to local variables.
+  phase_begin(PH_FRAME);
+  layout_frames(prog);
+  phase_end();
+
+  // Lower the AST to three-address code.
+  phase_begin(PH_LOWER);
+  lower(prog);
+  phase_end();
+  return prog;
+}
+
+// Appends the code for `prog` to `buf`, or to `obj` when writing an
+// object file, whose global variables are collected in `globals`.
+static void emit_program(Program* prog, Buf* buf, Object* obj,
+                         VarList** globals) {
+  if (opt_dump_ir) {
+    phase_begin(PH_EMIT);
+    dump_ir(prog, buf);
+    phase_end();
+  } else if (opt_c) {
+    codegen_object(prog, obj);
+    VarList* vl = prog->globals;
+    while (vl && vl->next)
+      vl = vl->next;
+    if (vl) {
+      vl->next = *globals;
+      *globals = prog->globals;
+    }
+  } else {
+    codegen(prog, buf);
+  }
+}
+
+// Writes the code in `buf`, or in `obj` when writing an object file,
+// to `path`.
+static void write_output(Buf* buf, Object* obj, VarList* globals,
+                         char* path) {
+  if (opt_c && !opt_dump_ir) {
+    phase_begin(PH_EMIT);
+    write_elf(obj, globals, buf);
+    phase_end();
+  }
+
+  phase_begin(PH_WRITE);
+  FILE* out = open_file(path);
+  buf_write(buf, out);
+  if (fclose(out) != 0)
+    error("cannot write output file: %s", strerror(errno));
+  phase_end();
+}
+
+// Returns the output path for input `path` when compiling several
+// files: its base name with the extension replaced, in the current
+// directory, like cc -c does. Inputs with the same base name in
+// different directories therefore overwrite each other's output.
+static char* output_path_for(char* path) {
+  char* base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+  char* dot = strrchr(base, '.');
+  size_t len = dot && dot != base ? (size_t)(dot - base) : strlen(base);
+  char* ext = opt_dump_ir ? ".ir" : opt_c ? ".o" : ".s";
+
+  char* out = malloc(len + strlen(ext) + 1);
+  memcpy(out, base, len);
+  strcpy(out + len, ext);
+  return out;
+}
+
+// Compiles the file `path` into its own output. Returns false if
+// there was an error.
+static bool compile_file(char* path) {
+  jmp_buf env;
+  if (setjmp(env)) {
+    // Undo what the error cut short before the next file.
+    error_jmp = NULL;
+    reset_phases();
+    reset_parser();
+    reset_lowering();
+    region_free();
+    if (user_input)
+      close_file(user_input);
+    return false;
+  }
+  error_jmp = &env;
+
+  current_filename = path;
+  user_input = NULL;
+  phase_begin(PH_READ);
+  user_input = read_file(path);
+  phase_end();
+
+  Program* prog = compile();
+  if (prog) {
+    Buf buf = {};
+    Object obj = {};
+    VarList* globals = NULL;
+    emit_program(prog, &buf, &obj, &globals);
+    char* out = output_path_for(path);
+    write_output(&buf, &obj, globals, out);
+    free(out);
+    free(buf.data);
+    obj_free(&obj);
+  }
+
+  region_free();
+  close_file(user_input);
+  error_jmp = NULL;
+  return true;
+}
+
+typedef struct {
+  atomic_int next;    // Next file to be taken by a worker
+  atomic_int failed;  // Number of files with errors
+  SymTable*  syms;
+} FileWork;
+
+static void* file_worker(void* arg) {
+  FileWork* w = arg;
+  for (int i; (i = w->next++) < ninputs;)
+    if (!compile_file(input_paths[i]))
+      w->failed++;
+  stats_flush();
+  return NULL;
+}
+
+// Compiles every input file on its own, on up to opt_jobs threads.
+// Each file is compiled entirely on one thread. Returns the exit
+// status.
+static int compile_files(void) {
+  int nthreads = opt_jobs < ninputs ? opt_jobs : ninputs;
+  opt_jobs = 1;
+
+  FileWork w = {};
+  pthread_t* threads = calloc(nthreads, sizeof(pthread_t));
+  for (int i = 0; i < nthreads; i++) {
+    int err = pthread_create(&threads[i], NULL, file_worker, &w);
+    if (err)
+      error("cannot create thread: %s", strerror(err));
+  }
+  for (int i = 0; i < nthreads; i++)
+    pthread_join(threads[i], NULL);
+  free(threads);
+  return w.failed ? 1 : 0;
+}
+
+// Prints the statistics that were asked for.
+static void report(void) {
+  stats_flush();
+  cache_evict();
+  if (opt_peephole_stats)
+    print_peephole_stats(stderr);
+  if (opt_cache_stats)
+    print_cache_stats(stderr);
+  if (opt_time_report)
+    print_stats(stderr, false);
+  if (opt_stats_path) {
+    FILE* out = open_file(opt_stats_path);
+    print_stats(out, true);
+    if (out != stdout && fclose(out) != 0)
+      error("cannot write %s: %s", opt_stats_path, strerror(errno));
+  }
+}
+
+int main(int argc, char **argv) {
+  parse_args(argc, argv);
+  if (opt_batch && opt_run)
+    error("--batch cannot be used with --run");
+
+  if (ninputs > 1) {
+    int status = compile_files();
+    report();
+    return status;
+  }
+
+  char* input_path = input_paths[0];
+  phase_begin(PH_READ);
+  char* input = read_file(input_path);
+  phase_end();
+  Buf buf = {};
+  Object obj = {};
+  VarList* globals = NULL;
+
+  if (opt_batch) {
+    // Compile each snippet on its own, as if it were a separate
+    // file, into a single output.
+    char* p = input;
+    for (int i = 0; *p; i++) {
+      current_filename = malloc(strlen(input_path) + 16);
+      sprintf(current_filename, "%s#%d", input_path, i);
+      phase_begin(PH_READ);
+      user_input = next_snippet(&p);
+      phase_end();
+      Program* prog = compile();
+      if (prog) {
+        prefix_symbols(prog, i);
+        emit_program(prog, &buf, &obj, &globals);
+      }
+      free(user_input);
+      free(current_filename);
+    }
+  } else {
+    current_filename = input_path;
+    user_input = input;
+    Program* prog = compile();
+    if (!prog) {
+      report();
+      return 0;
+    }
+
+    // Run the program in this process if requested.
+    if (opt_run && !opt_dump_ir) {
+      codegen_object(prog, &obj);
+      report();
+      return jit_run(&obj, prog->globals);
+    }
+    emit_program(prog, &buf, &obj, &globals);
+  }
+
+  if (opt_fsyntax_only) {
+    report();
+    return 0;
+  }
+
+  write_output(&buf, &obj, globals, output_path);
+  free(buf.data);
+  obj_free(&obj);
+  region_free();
+  close_file(input);
+  report();
+  return 0;
+}
@@ -2,85 +2,162 @@
 
 // All local variable instance created during parsing are
 // accumulated to this list
-static VarList* locals;
-static VarList* globals;
-
-// Find a local variable by name.
-static Var *find_var(Token* tok) {
-  for (VarList* vl = locals; vl != NULL; vl = vl->next) {
-    Var* var = vl->var;
-    if (strlen(var->name) == tok->len && !strncmp(var->name, tok->str, tok->len)) {
-      return var;
-    }
+static _Thread_local VarList* locals;
+// and those of the innermost block or function to this one.
+static _Thread_local VarList* decls;
+static _Thread_local VarList* globals;
+
+// Scope
+//
+// `var_scope` maps each name to its innermost binding, and a binding
+// links to the binding of the same name it shadows. Scopes are
+// numbered by depth (0 is the file scope) and each gets a unique ID
+// when it is entered. A binding is visible only while the scope at its
+// depth still has the ID it was declared in, so leaving a scope just
+// decrements the depth; stale bindings are dropped lazily on lookup.
+//
+// The file, each function and each block have a scope of their own,
+// and a name refers to its binding in the innermost scope that has
+// one: locals shadow globals, and variables of a block shadow those
+// of the enclosing blocks and function.
+static _Thread_local HashMap var_scope;
+static _Thread_local int*    scope_ids;
+static _Thread_local int     scope_cap;
+static _Thread_local int     scope_depth;
+static _Thread_local int     last_scope_id;
+
+static void enter_scope(void) {
+  if (++scope_depth >= scope_cap) {
+    scope_cap = scope_cap ? scope_cap * 2 : 16;
+    scope_ids = realloc(scope_ids, scope_cap * sizeof(int));
   }
+  scope_ids[scope_depth] = ++last_scope_id;
+}
 
-  for (VarList* vl = globals; vl != NULL; vl = vl->next) {
-    Var* var = vl->var;
-    if (strlen(var->name) == tok->len && !strncmp(var->name, tok->str, tok->len)) {
-      return var;
-    }
+static void leave_scope(void) {
+  scope_depth--;
+}
+
+static bool is_visible(Var* var) {
+  return var->depth <= scope_depth && scope_ids[var->depth] == var->scope;
+}
+
+// Find a variable by name.
+static Var *lookup_var(int sym) {
+  Var* var = hashmap_get(&var_scope, sym);
+  if (var && !is_visible(var)) {
+    while (var && !is_visible(var))
+      var = var->shadow;
+    hashmap_put(&var_scope, sym, var);
+  }
+  return var;
+}
+
+static Var *find_var(int tok) {
+  return lookup_var(tokens.val[tok]);
+}
+
+// Declare a variable in the current scope.
+static void push_scope(Var* var) {
+  var->shadow = lookup_var(var->sym);
+  var->depth = scope_depth;
+  var->scope = scope_ids[scope_depth];
+  hashmap_put(&var_scope, var->sym, var);
+}
+
+// Returns the number of bytes a node of `kind` needs.
+static size_t node_size(NodeKind kind) {
+  switch (kind) {
+    case ND_IF:
+      return offsetof(Node, els) + sizeof(Node*);
+    case ND_WHILE:
+      return offsetof(Node, then) + sizeof(Node*);
+    case ND_FOR:
+      return offsetof(Node, inc) + sizeof(Node*);
+    case ND_BLOCK:
+      return offsetof(Node, decls) + sizeof(VarList*);
+    case ND_FUNCALL:
+      return offsetof(Node, funcsym) + sizeof(int);
+    case ND_VAR:
+    case ND_NUM:
+      return offsetof(Node, val) + sizeof(long);
+    case ND_NULL:
+      return offsetof(Node, lhs);
+    default:
+      return offsetof(Node, rhs) + sizeof(Node*);
   }
-  return NULL;
 }
 
-static Node *new_node(NodeKind kind, Token* tok) {
-  Node* node = (Node *)calloc(1, sizeof(Node));
+static Node *new_node(NodeKind kind, int tok) {
+  Node* node = region_alloc(MEM_NODES, node_size(kind));
   node->kind = kind;
   node->tok  = tok;
+  stats.nodes++;
   return node;
 }
 
-static Node *new_binary(NodeKind kind, Node* lhs, Node* rhs, Token* tok) {
+static Node *new_binary(NodeKind kind, Node* lhs, Node* rhs, int tok) {
   Node* node = new_node(kind, tok);
   node->lhs = lhs;
   node->rhs = rhs;
+  add_type(node);
   return node;
 }
 
-static Node *new_unary(NodeKind kind, Node* expr, Token* tok) {
+static Node *new_unary(NodeKind kind, Node* expr, int tok) {
   Node* node = new_node(kind, tok);
   node->lhs = expr;
+  add_type(node);
   return node;
 }
 
-static Node *new_num(long val, Token* tok) {
+static Node *new_num(long val, int tok) {
   Node* node = new_node(ND_NUM, tok);
   node->val = val;
+  add_type(node);
   return node;
 }
 
-static Node *new_var_node(Var *var, Token* tok) {
+static Node *new_var_node(Var *var, int tok) {
   Node* node = new_node(ND_VAR, tok);
   node->var = var;
+  add_type(node);
   return node;
 }
 
-static Var *new_var(char* name, Type* ty, bool is_local) {
-  Var* var = calloc(1, sizeof(Var));
-  var->name = name;
+static Var *new_var(int sym, Type* ty, bool is_local) {
+  Var* var = region_alloc(MEM_VARS, sizeof(Var));
+  var->sym = sym;
   var->ty = ty;
   var->is_local = is_local;
-  var->len = strlen(name);
+  stats.vars++;
   return var;
 }
 
-static Var *new_lvar(char* name, Type* ty) {
-  Var *var = new_var(name, ty, true);
+static Var *new_lvar(int sym, Type* ty) {
+  Var *var = new_var(sym, ty, true);
 
-  VarList* vl = calloc(1, sizeof(VarList));
+  VarList* vl = region_alloc(MEM_VARS, sizeof(VarList));
   vl->var = var;
   vl->next = locals;
   locals = vl;
+
+  vl = region_alloc(MEM_VARS, sizeof(VarList));
+  vl->var = var;
+  vl->next = decls;
+  decls = vl;
+  push_scope(var);
   return var;
 }
 
-static Var *new_gvar(char* name, Type* ty) {
-  Var* var = new_var(name, ty, false);
+static Var *new_gvar(int sym, Type* ty) {
+  Var* var = new_var(sym, ty, false);
 
-  VarList* vl = calloc(1, sizeof(VarList));
+  VarList* vl = region_alloc(MEM_VARS, sizeof(VarList));
   vl->var = var;
   vl->next = globals;
   globals = vl;
+  push_scope(var);
   return var;
 }
 
@@ -89,23 +166,14 @@ static Type* basetype(void);
 static void  global_var(void);
 static Node* declaration(void);
 static Node* stmt(void);
-static Node* stmt2(void);
 static Node* expr(void);
-static Node* assign(void);
-static Node* equality(void);
-static Node* relational(void);
-static Node* add(void);
-static Node* mul(void);
-static Node* unary(void);
-static Node* postfix(void);
-static Node* primary(void);
 
 // Determine whether the next top-level item is a function
 // or a global variable by looking ahead input tokens.
 static bool is_function(void) {
-  Token* tok = token;
+  int tok = token;
   basetype();
-  bool isfunc = consume_ident() && consume("(");
+  bool isfunc = consume_ident() && consume(TOK_LPAREN);
   token = tok;
   return isfunc;
 }
@@ -116,6 +184,15 @@ Program* program(void) {
   Function* cur = &head;
   globals = NULL;
 
+  // Bindings left by an earlier compilation refer to freed variables.
+  free(var_scope.buckets);
+  var_scope = (HashMap){};
+  reset_types();
+
+  // Enter the file scope.
+  scope_depth = -1;
+  enter_scope();
+
   while (!at_eof()) {
     if (is_function()) {
       cur->next = function();
@@ -125,7 +202,7 @@ Program* program(void) {
     }
   }
 
-  Program* prog = calloc(1, sizeof(Program));
+  Program* prog = region_alloc(MEM_FUNCS, sizeof(Program));
   prog->fns = head.next;
   prog->globals = globals;
   return prog;
@@ -133,41 +210,41 @@ Program* program(void) {
 
 // basetype = "int" "*"*
 static Type* basetype(void) {
-  expect("int");
+  expect(TOK_INT);
   Type* ty = int_type;
-  while (consume("*"))
+  while (consume(TOK_STAR))
     ty = pointer_to(ty);
   return ty;
 }
 
 static Type* read_type_suffix(Type* base) {
-  if (!consume("["))
+  if (!consume(TOK_LBRACKET))
     return base;
   int sz = expect_number();
-  expect("]");
+  expect(TOK_RBRACKET);
   base = read_type_suffix(base);
   return array_of(base, sz);
 }
 
 static VarList* read_func_param(void) {
   Type* ty = basetype();
-  char* name = expect_ident();
+  int sym = expect_ident();
   ty = read_type_suffix(ty);
 
-  VarList* vl = calloc(1, sizeof(VarList));
-  vl->var = new_lvar(name, ty);
+  VarList* vl = region_alloc(MEM_VARS, sizeof(VarList));
+  vl->var = new_lvar(sym, ty);
   return vl;
 }
 
 static VarList* read_func_params(void) {
-  if (consume(")"))
+  if (consume(TOK_RPAREN))
     return NULL;
 
   VarList* head = read_func_param();
   VarList* cur = head;
 
-  while (!consume(")")) {
-    expect(",");
+  while (!consume(TOK_RPAREN)) {
+    expect(TOK_COMMA);
     cur->next = read_func_param();
     cur = cur->next;
   }
@@ -175,71 +252,129 @@ static VarList* read_func_params(void) {
   return head;
 }
 
+// Returns the index of the "}" that closes the "{" at `tok`, or 0
+// if there is none.
+static int matching_brace(int tok) {
+  int depth = 0;
+  for (; tokens.kind[tok] != TK_EOF; tok++) {
+    if (tokens.kind[tok] != TK_RESERVED)
+      continue;
+    if (tokens.id[tok] == TOK_LBRACE)
+      depth++;
+    else if (tokens.id[tok] == TOK_RBRACE && --depth == 0)
+      return tok;
+  }
+  return 0;
+}
+
+// Computes the cache key of the function whose tokens are
+// `start`..`end`. Any identifier may name a global variable, whose
+// type then affects the code, so the types of those are included.
+static CacheKey function_key(int start, int end) {
+  CacheKey key = cache_key();
+  for (int tok = start; tok <= end; tok++) {
+    hash_long(&key, tokens.kind[tok]);
+    switch (tokens.kind[tok]) {
+      case TK_RESERVED:
+        hash_long(&key, tokens.id[tok]);
+        if (tokens.id[tok] == TOK_PUNCT)
+          hash_bytes(&key, tok_str(tok), tokens.len[tok]);
+        break;
+      case TK_NUM:
+        hash_long(&key, tokens.val[tok]);
+        break;
+      case TK_IDENT: {
+        hash_long(&key, tokens.len[tok]);
+        hash_bytes(&key, tok_str(tok), tokens.len[tok]);
+        Var* var = find_var(tok);
+        if (var && !var->is_local)
+          for (Type* ty = var->ty; ty; ty = ty->base)
+            hash_long(&key, (long)ty->kind << 32 | ty->array_len);
+        break;
+      }
+    }
+  }
+  return key;
+}
+
 // function = basetype ident "(" params? ")" "{" stmt* "}"
 // params   = param ("," param)*
 // param    = basetype ident
 Function *function(void) {
   locals = NULL;
+  decls = NULL;
+  enter_scope();
 
-  Function* fn = calloc(1, sizeof(Function));
+  Function* fn = region_alloc(MEM_FUNCS, sizeof(Function));
+  int start = token;
   basetype();
-  fn->name = expect_ident();
-  expect("(");
+  fn->sym = expect_ident();
+  expect(TOK_LPAREN);
   fn->params = read_func_params();
-  expect("{");
+
+  // If the function's code is cached, skip its body.
+  int end;
+  if (cache_enabled && peek(TOK_LBRACE) && (end = matching_brace(token))) {
+    fn->key = function_key(start, end);
+    fn->cacheable = true;
+    fn->cached = cache_get(&fn->key);
+    if (fn->cached) {
+      token = end + 1;
+      fn->locals = locals;
+      leave_scope();
+      return fn;
+    }
+  }
+  expect(TOK_LBRACE);
 
   Node head = {};
   Node* cur = &head;
 
-  while(!consume("}")) {
+  while(!consume(TOK_RBRACE)) {
     cur->next = stmt();
     cur = cur->next;
   }
 
   fn->node = head.next;
   fn->locals = locals;
+  fn->decls = decls;
+  leave_scope();
   return fn;
 }
 
 // global-var = basetype ident ("[" num "]")* ";"
 static void global_var(void) {
   Type* ty = basetype();
-  char* name = expect_ident();
+  int sym = expect_ident();
   ty = read_type_suffix(ty);
-  expect(";");
-  new_gvar(name, ty);
+  expect(TOK_SEMI);
+  new_gvar(sym, ty);
 }
 
 // declaration = basetype ident ("[" num "]")* ("=" expr) ";"
 static Node* declaration(void) {
-  Token* tok = token;
+  int tok = token;
   Type* ty = basetype();
-  char* name = expect_ident();
+  int sym = expect_ident();
   ty = read_type_suffix(ty);
-  Var* var = new_lvar(name, ty);
+  Var* var = new_lvar(sym, ty);
 
-  if (consume(";"))
+  if (consume(TOK_SEMI))
     return new_node(ND_NULL, tok);
   
-  expect("=");
+  expect(TOK_ASSIGN);
   Node* lhs = new_var_node(var, tok);
   Node* rhs = expr();
-  expect(";");
+  expect(TOK_SEMI);
   Node* node = new_binary(ND_ASSIGN, lhs, rhs, tok);
   return new_unary(ND_EXPR_STMT, node, tok);
 }
 
 static Node *read_expr_stmt(void) {
-  Token* tok = token;
+  int tok = token;
   return new_unary(ND_EXPR_STMT, expr(), tok);
 }
 
-static Node* stmt(void) {
-  Node* node = stmt2();
-  add_type(node);
-  return node;
-}
-
 // stmt = "return" expr ";"
 //      | "if" "(" expr ")" stmt ("else" stmt)?
 //      | "while" "(" expr ")" stmt
@@ -247,132 +382,84 @@ static Node* stmt(void) {
 //      | "{" stmt* "}"
 //      | declaration
 //      | expr ";"
-static Node* stmt2(void) {
-  Token* tok = NULL;
-  if (tok = consume("return")) {
+static Node* stmt(void) {
+  int tok = 0;
+  if ((tok = consume(TOK_RETURN))) {
     Node* node = new_unary(ND_RETURN, expr(), tok);
-    expect(";");
+    expect(TOK_SEMI);
     return node;
   }
 
-  if (tok = consume("if")) {
+  if ((tok = consume(TOK_IF))) {
     Node* node = new_node(ND_IF, tok);
-    expect("(");
+    expect(TOK_LPAREN);
     node->cond = expr();
-    expect(")");
+    expect(TOK_RPAREN);
     node->then = stmt();
-    if (consume("else")) {
+    if (consume(TOK_ELSE)) {
       node->els = stmt();
     }
     return node;
   }
 
-  if (tok = consume("while")) {
+  if ((tok = consume(TOK_WHILE))) {
     Node* node = new_node(ND_WHILE, tok);
-    expect("(");
+    expect(TOK_LPAREN);
     node->cond = expr();
-    expect(")");
+    expect(TOK_RPAREN);
     node->then = stmt();
     return node;
   }
 
-  if (tok = consume("for")) {
+  if ((tok = consume(TOK_FOR))) {
     Node* node = new_node(ND_FOR, tok);
-    expect("(");
-    if (!consume(";")) {
+    expect(TOK_LPAREN);
+    if (!consume(TOK_SEMI)) {
       node->init = read_expr_stmt();
-      expect(";");
+      expect(TOK_SEMI);
     }
-    if (!consume(";")) {
+    if (!consume(TOK_SEMI)) {
       node->cond = expr();
-      expect(";");
+      expect(TOK_SEMI);
     }
-    if (!consume(")")) {
+    if (!consume(TOK_RPAREN)) {
       node->inc = read_expr_stmt();
-      expect(")");
+      expect(TOK_RPAREN);
     }
     node->then = stmt();
     return node;
   }
 
-  if (tok = consume("{")) {
+  if ((tok = consume(TOK_LBRACE))) {
     Node  head = {};
     Node* cur = &head;
+    VarList* outer = decls;
+    decls = NULL;
+    enter_scope();
 
-    while (!consume("}")) {
+    while (!consume(TOK_RBRACE)) {
       cur->next = stmt();
       cur = cur->next;
     }
     
     Node* node = new_node(ND_BLOCK, tok);
     node->block = head.next;
+    node->decls = decls;
+    decls = outer;
+    leave_scope();
     return node;
   }
 
-  if (tok = peek("int")) {
+  if ((tok = peek(TOK_INT))) {
     return declaration();
   }
 
   Node *node = read_expr_stmt();
-  expect(";");
+  expect(TOK_SEMI);
   return node;
 }
 
-// expr = assign
-static Node* expr(void) {
-  return assign();
-}
-
-// assgin = equality ("=" assign)?
-static Node* assign(void) {
-  Node* node = equality();
-  Token* tok = NULL;
-  if (tok = consume("=")) {
-    node = new_binary(ND_ASSIGN, node, assign(), tok);
-  }
-  return node;
-}
-
-// equality = relational ("==" relational | "!=" relational)*
-static Node* equality(void) {
-  Node* node = relational();
-  Token* tok = NULL;
-
-  while(1) {
-    if (tok = consume("==")) {
-      node = new_binary(ND_EQ, node, relational(), tok);
-    } else if (tok = consume("!=")) {
-      node = new_binary(ND_NE, node, relational(), tok);
-    } else {
-      return node;
-    }
-  }
-}
-
-// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
-static Node* relational(void) {
-  Node* node = add();
-  Token* tok = NULL;
-
-  while(1) {
-    if (tok = consume("<")) {
-      node = new_binary(ND_LT, node, add(), tok);
-    } else if (tok = consume("<=")) {
-      node = new_binary(ND_LE, node, add(), tok);
-    } else if (tok = consume(">")) {
-      node = new_binary(ND_LT, add(), node, tok);
-    } else if (tok = consume(">=")) {
-      node = new_binary(ND_LE, add(), node, tok);
-    } else {
-      return node;
-    }
-  }
-}
-
-static Node* new_add(Node* lhs, Node* rhs, Token* tok) {
-  add_type(lhs);
-  add_type(rhs);
-
+static Node* new_add(Node* lhs, Node* rhs, int tok) {
   if (is_integer(lhs->ty) && is_integer(rhs->ty))
     return new_binary(ND_ADD, lhs, rhs, tok);
   if (lhs->ty->base && is_integer(rhs->ty))
@@ -382,10 +469,7 @@ static Node* new_add(Node* lhs, Node* rhs, Token* tok) {
   error_tok(tok, "invaild operands");
 }
 
-static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
-  add_type(lhs);
-  add_type(rhs);
-
+static Node *new_sub(Node *lhs, Node *rhs, int tok) {
   if (is_integer(lhs->ty) && is_integer(rhs->ty))
     return new_binary(ND_SUB, lhs, rhs, tok);
   if (lhs->ty->base && is_integer(rhs->ty))
@@ -395,122 +479,292 @@ static Node *new_sub(Node *lhs, Node *rhs, Token *tok) {
   error_tok(tok, "invalid operands");
 }
 
-// add = mul ("+" mul | "-" mul)*
-static Node* add(void) {
-  Node* node = mul();
-  Token* tok = NULL;
-
-  while(1) {
-    if (tok = consume("+")) {
-      node = new_add(node, mul(), tok);
-    } else if (tok = consume("-")) {
-      node = new_sub(node, mul(), tok);
-    } else {
-      return node;
-    }
+// Expressions
+//
+// expr       = assign
+// assign     = equality ("=" assign)?
+// equality   = relational ("==" relational | "!=" relational)*
+// relational = add ("<" add | "<=" add | ">" add | ">=" add)*
+// add        = mul ("+" mul | "-" mul)*
+// mul        = unary ("*" unary | "/" unary)*
+// unary      = ("+" | "-" | "*" | "&" | "sizeof") unary
+//            | postfix
+// postfix    = primary ("[" expr "]")*
+// primary    = num
+//            | ident ("(" (assign ("," assign)*)? ")")?
+//            | "(" expr ")"
+//
+// Rather than descending once per nesting level, expressions are
+// parsed by operator precedence with explicit stacks of operands and
+// pending operators, so deeply nested input cannot overflow the
+// native stack. An operator is reduced with the topmost operands
+// when an operator that binds no tighter follows it, or when the
+// parenthesis, bracket or call it is inside is closed.
+
+typedef struct {
+  TokenId id;      // "(", "[" or a prefix or binary operator
+  int     tok;
+  bool    prefix;
+  Node*   call;    // For the "(" of a call, the call and its
+  Node*   last;    // last argument so far
+} Op;
+
+static _Thread_local Op*    ops;
+static _Thread_local int    nops;
+static _Thread_local int    ops_cap;
+static _Thread_local Node** vals;
+static _Thread_local int    nvals;
+static _Thread_local int    vals_cap;
+
+static void push_op(TokenId id, int tok, bool prefix, Node* call) {
+  if (nops == ops_cap) {
+    ops_cap = ops_cap ? ops_cap * 2 : 64;
+    ops = realloc(ops, ops_cap * sizeof(Op));
   }
+  ops[nops++] = (Op){ id, tok, prefix, call, NULL };
 }
 
-// mul = unary ("*" unary | "/" unary)*
-static Node* mul(void) {
-  Node* node = unary();
-  Token* tok = NULL;
+static void push_val(Node* node) {
+  if (nvals == vals_cap) {
+    vals_cap = vals_cap ? vals_cap * 2 : 64;
+    vals = realloc(vals, vals_cap * sizeof(Node*));
+  }
+  vals[nvals++] = node;
+}
+
+static Node* pop_val(void) {
+  return vals[--nvals];
+}
+
+// Empties the stacks an error may have left behind.
+void reset_parser(void) {
+  nops = 0;
+  nvals = 0;
+}
+
+// Returns how tightly a binary operator binds, or 0 if `id` is not one.
+static int binary_prec(TokenId id) {
+  switch (id) {
+  case TOK_ASSIGN:
+    return 1;
+  case TOK_EQ:
+  case TOK_NE:
+    return 2;
+  case TOK_LT:
+  case TOK_LE:
+  case TOK_GT:
+  case TOK_GE:
+    return 3;
+  case TOK_PLUS:
+  case TOK_MINUS:
+    return 4;
+  case TOK_STAR:
+  case TOK_SLASH:
+    return 5;
+  default:
+    return 0;
+  }
+}
 
-  while(1) {
-    if (tok = consume("*")) {
-      node = new_binary(ND_MUL, node, unary(), tok);
-    } else if (tok = consume("/")) {
-      node = new_binary(ND_DIV, node, unary(), tok);
-    } else {
-      return node;
+// Prefix operators bind tighter than any binary one, and "(" and "["
+// are never reduced by precedence.
+static int op_prec(Op* op) {
+  if (op->prefix)
+    return 6;
+  return binary_prec(op->id);
+}
+
+static bool is_group(Op* op) {
+  return op_prec(op) == 0;
+}
+
+// Applies the topmost operator to the topmost operands.
+static void reduce(void) {
+  Op* op = &ops[--nops];
+  int tok = op->tok;
+
+  if (op->prefix) {
+    Node* node = pop_val();
+    switch (op->id) {
+    case TOK_MINUS:
+      push_val(new_binary(ND_SUB, new_num(0, tok), node, tok));
+      return;
+    case TOK_AMP:
+      push_val(new_unary(ND_ADDR, node, tok));
+      return;
+    case TOK_STAR:
+      push_val(new_unary(ND_DEREF, node, tok));
+      return;
+    default:
+      push_val(new_num(node->ty->size, tok));
+      return;
     }
   }
-}
 
-// unary = ("+" | "-" | "*" | "&")? unary
-//       | postfix
-static Node* unary(void) {
-  Token* tok = NULL;
-  if (consume("+"))
-    return unary();
-  if (tok = consume("-"))
-    return new_binary(ND_SUB, new_num(0, tok), unary(), tok);
-  if (tok = consume("&"))
-    return new_unary(ND_ADDR, unary(), tok);
-  if (tok = consume("*"))
-    return new_unary(ND_DEREF, unary(), tok);
-  return postfix();
+  Node* rhs = pop_val();
+  Node* lhs = pop_val();
+  switch (op->id) {
+  case TOK_ASSIGN:
+    push_val(new_binary(ND_ASSIGN, lhs, rhs, tok));
+    return;
+  case TOK_EQ:
+    push_val(new_binary(ND_EQ, lhs, rhs, tok));
+    return;
+  case TOK_NE:
+    push_val(new_binary(ND_NE, lhs, rhs, tok));
+    return;
+  case TOK_LT:
+    push_val(new_binary(ND_LT, lhs, rhs, tok));
+    return;
+  case TOK_LE:
+    push_val(new_binary(ND_LE, lhs, rhs, tok));
+    return;
+  case TOK_GT:
+    push_val(new_binary(ND_LT, rhs, lhs, tok));
+    return;
+  case TOK_GE:
+    push_val(new_binary(ND_LE, rhs, lhs, tok));
+    return;
+  case TOK_PLUS:
+    push_val(new_add(lhs, rhs, tok));
+    return;
+  case TOK_MINUS:
+    push_val(new_sub(lhs, rhs, tok));
+    return;
+  case TOK_STAR:
+    push_val(new_binary(ND_MUL, lhs, rhs, tok));
+    return;
+  default:
+    push_val(new_binary(ND_DIV, lhs, rhs, tok));
+    return;
+  }
 }
 
-// postfix = primary ("[" expr "]")*
-static Node* postfix(void) {
-  Node* node = primary();
-  Token* tok;
+// Reduces operators down to the innermost open group above `base`.
+static void reduce_group(int base) {
+  while (nops > base && !is_group(&ops[nops - 1]))
+    reduce();
+}
+
+// Reads an operand up to its first postfix or binary operator.
+// Prefix operators and opening parentheses are pushed as operators,
+// and the primary is pushed as a value.
+static void operand(void) {
+  int tok;
+  for (;;) {
+    if (consume(TOK_PLUS))
+      continue;
+    if ((tok = consume(TOK_MINUS)) || (tok = consume(TOK_AMP)) ||
+        (tok = consume(TOK_STAR)) || (tok = consume(TOK_SIZEOF))) {
+      push_op(tokens.id[tok], tok, true, NULL);
+      continue;
+    }
+    if ((tok = consume(TOK_LPAREN))) {
+      push_op(TOK_LPAREN, tok, false, NULL);
+      continue;
+    }
 
-  while (tok = consume("[")) {
-    // x[y] is short for *(x+y)
-    Node* exp = new_add(node, expr(), tok);
-    expect("]");
-    node = new_unary(ND_DEREF, exp, tok);
+    if ((tok = consume_ident())) {
+      // Function call
+      if (consume(TOK_LPAREN)) {
+        Node* node = new_node(ND_FUNCALL, tok);
+        node->funcsym = tokens.val[tok];
+        add_type(node);
+        if (consume(TOK_RPAREN)) {
+          push_val(node);
+          return;
+        }
+        // Continue with the first argument.
+        push_op(TOK_LPAREN, tok, false, node);
+        continue;
+      }
+
+      // Variable
+      Var* var = find_var(tok);
+      if (!var) {
+        error_tok(tok, "undefined variable");
+      }
+      push_val(new_var_node(var, tok));
+      return;
+    }
+
+    tok = token;
+    if (tokens.kind[tok] != TK_NUM) {
+      error_tok(tok, "expected expression");
+    }
+    push_val(new_num(expect_number(), tok));
+    return;
   }
-  return node;
 }
 
-// func-args = "(" (assign ("," assign)*)? ")"
-static Node* func_args() {
-  if (consume(")")) {
-    return NULL;
-  }
+static Node* expr(void) {
+  int op_base = nops;
+  int val_base = nvals;
+  int tok;
+  operand();
 
-  Node* head = assign();
-  Node* cur = head;
-  while (consume(",")) {
-    cur->next = assign();
-    cur = cur->next;
-  }
-  expect(")");
-  return head;
-}
+  for (;;) {
+    // x[y] is short for *(x+y)
+    if ((tok = consume(TOK_LBRACKET))) {
+      push_op(TOK_LBRACKET, tok, false, NULL);
+      operand();
+      continue;
+    }
 
-// primary = num
-//         | "sizeof" unary
-//         | ident func-args?
-//         | "(" expr ")" 
-static Node* primary(void) {
-  Token* tok = NULL;
+    int prec = binary_prec(tokens.id[token]);
+    if (prec) {
+      // "=" is right-associative; the others are left-associative.
+      bool right = tokens.id[token] == TOK_ASSIGN;
+      while (nops > op_base &&
+             (op_prec(&ops[nops - 1]) > prec ||
+              (!right && op_prec(&ops[nops - 1]) == prec)))
+        reduce();
+      push_op(tokens.id[token], token, false, NULL);
+      token++;
+      operand();
+      continue;
+    }
 
-  if (consume("(")) {
-    Node* node = expr();
-    expect(")");
-    return node;
-  }
+    reduce_group(op_base);
+    Op* group = nops > op_base ? &ops[nops - 1] : NULL;
 
-  if (tok = consume("sizeof")) {
-    Node* node = unary();
-    add_type(node);
-    return new_num(node->ty->size, tok);
-  }
+    if (group && group->id == TOK_LBRACKET && (tok = consume(TOK_RBRACKET))) {
+      Node* idx = pop_val();
+      Node* node = pop_val();
+      push_val(new_unary(ND_DEREF, new_add(node, idx, group->tok), group->tok));
+      nops--;
+      continue;
+    }
 
-  if (tok = consume_ident()) {
-    // Function call
-    if (consume("(")) {
-      Node* node = new_node(ND_FUNCALL, tok);
-      node->funcname = strndup(tok->str, tok->len);
-      node->args = func_args();
-      return node;
+    if (group && group->id == TOK_LPAREN && group->call &&
+        (peek(TOK_COMMA) || peek(TOK_RPAREN))) {
+      Node* call = group->call;
+      Node* arg = pop_val();
+      if (group->last)
+        group->last->next = arg;
+      else
+        call->args = arg;
+      group->last = arg;
+
+      if (consume(TOK_COMMA)) {
+        operand();
+        continue;
+      }
+      token++;
+      nops--;
+      push_val(call);
+      continue;
     }
 
-    // Variable
-    Var* var = find_var(tok);
-    if (!var) {
-      error_tok(tok, "undefined variable");
+    if (group && group->id == TOK_LPAREN && consume(TOK_RPAREN)) {
+      nops--;
+      continue;
     }
-    return new_var_node(var, tok);
-  }
 
-  tok = token;
-  if (tok->kind != TK_NUM) {
-    error_tok(tok, "expected expression");
+    // The expression ends here, unless a group is left open.
+    if (group)
+      expect(group->id == TOK_LBRACKET ? TOK_RBRACKET : TOK_RPAREN);
+    assert(nvals == val_base + 1);
+    return pop_val();
   }
-  return new_num(expect_number(), tok);
 }
\ No newline at end of file
@@ -0,0 +1,483 @@
+#include "litecc.h"
+
+// Peephole optimizer.
+//
+// Rewrites short windows of a function's instruction list with the
+// rules in `rules` below, repeating until no rule applies. Rules
+// that need to know whether a register is still used consult a
+// liveness analysis over the function's control-flow graph, which
+// is recomputed before every sweep.
+//
+// The rules assume the code generator's conventions: flags are only
+// read right after the cmp or and that sets them, and setcc always
+// writes al.
+
+typedef struct {
+  Inst*     in;
+  int       len;
+  uint32_t* live_out;  // Registers live after each instruction
+  HashMap   labels;    // Label number -> index of its definition + 1
+} Peephole;
+
+typedef struct {
+  char* name;
+  bool (*apply)(Peephole* p, int i);
+  atomic_long count;
+} Rule;
+
+// Functions may be optimized on several threads at once, so the
+// statistics are updated atomically.
+static atomic_long insts_before;
+static atomic_long insts_after;
+
+static uint32_t bit(Reg reg) {
+  return 1u << reg;
+}
+
+#define CALLER_SAVED (bit(RAX) | bit(RCX) | bit(RDX) | bit(RSI) | bit(RDI) | \
+                      bit(R8) | bit(R9) | bit(R10) | bit(R11))
+#define CALLEE_SAVED (bit(RBX) | bit(R12) | bit(R13) | bit(R14) | bit(R15))
+#define ARG_REGS     (bit(RDI) | bit(RSI) | bit(RDX) | bit(RCX) | bit(R8) | bit(R9))
+#define ALWAYS_LIVE  (bit(RSP) | bit(RBP))
+
+static bool is_reg(Operand* op, Reg reg) {
+  return op->kind == OPR_REG && op->reg == reg;
+}
+
+static bool is_imm_val(Operand* op, long val) {
+  return op->kind == OPR_IMM && op->val == val;
+}
+
+// Returns the registers an operand reads when it is used as a source.
+static uint32_t uses_of(Operand* op) {
+  if (op->kind == OPR_REG || (op->kind == OPR_MEM && op->reg != RIP))
+    return bit(op->reg);
+  return 0;
+}
+
+// Returns true if `op` mentions `reg` in any way.
+static bool mentions(Operand* op, Reg reg) {
+  return uses_of(op) & bit(reg);
+}
+
+// Computes the registers an instruction reads and writes.
+static void def_use(Inst* in, uint32_t* def, uint32_t* use) {
+  *def = *use = 0;
+  switch (in->kind) {
+    case I_MOV:
+    case I_LEA:
+      if (in->a.kind == OPR_REG)
+        *def = bit(in->a.reg);
+      else
+        *use = uses_of(&in->a);
+      *use |= uses_of(&in->b);
+      return;
+    case I_ADD:
+    case I_SUB:
+    case I_AND:
+    case I_NEG:
+      *def = uses_of(&in->a);
+      *use = uses_of(&in->a) | uses_of(&in->b);
+      return;
+    case I_IMUL:
+      *def = uses_of(&in->a);
+      *use = uses_of(&in->b);
+      if (in->c.kind == OPR_NONE)
+        *use |= uses_of(&in->a);
+      return;
+    case I_IDIV:
+      *def = bit(RAX) | bit(RDX);
+      *use = uses_of(&in->a) | bit(RAX) | bit(RDX);
+      return;
+    case I_CQO:
+      *def = bit(RDX);
+      *use = bit(RAX);
+      return;
+    case I_CMP:
+      *use = uses_of(&in->a) | uses_of(&in->b);
+      return;
+    case I_SETCC:
+      // Only al is written, but the code generator never reads the
+      // rest of rax after a setcc, so treat it as a full definition.
+      *def = bit(RAX);
+      return;
+    case I_MOVZB:
+      *def = uses_of(&in->a);
+      *use = bit(RAX);
+      return;
+    case I_PUSH:
+      *use = uses_of(&in->a);
+      return;
+    case I_POP:
+      *def = uses_of(&in->a);
+      return;
+    case I_CALL:
+      *def = CALLER_SAVED;
+      *use = bit(RAX) | ARG_REGS;
+      return;
+    case I_RET:
+      *use = bit(RAX) | CALLEE_SAVED;
+      return;
+  }
+}
+
+static bool is_jump(Inst* in) {
+  return in->kind == I_JMP || in->kind == I_JCC;
+}
+
+// Returns the index of the definition of the label a jump targets.
+static int jump_target(Peephole* p, Inst* in) {
+  return (int)(long)hashmap_get(&p->labels, in->a.val) - 1;
+}
+
+static void index_labels(Peephole* p) {
+  free(p->labels.buckets);
+  p->labels = (HashMap){};
+  for (int i = 0; i < p->len; i++)
+    if (p->in[i].kind == I_LABEL)
+      hashmap_put(&p->labels, p->in[i].a.val, (void*)(long)(i + 1));
+}
+
+// Backward liveness analysis, iterated to a fixed point so that
+// values live around loops are accounted for.
+static void compute_liveness(Peephole* p) {
+  int n = p->len;
+  uint32_t* live_in = calloc(n + 1, sizeof(uint32_t));
+  p->live_out = realloc(p->live_out, (n + 1) * sizeof(uint32_t));
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    for (int i = n - 1; i >= 0; i--) {
+      Inst* in = &p->in[i];
+      uint32_t out = 0;
+      if (in->kind != I_JMP && in->kind != I_RET)
+        out |= live_in[i + 1];
+      if (is_jump(in)) {
+        int t = jump_target(p, in);
+        out |= t >= 0 ? live_in[t] : ~0u;
+      }
+
+      uint32_t def, use;
+      def_use(in, &def, &use);
+      uint32_t in_set = use | (out & ~def) | ALWAYS_LIVE;
+      p->live_out[i] = out | ALWAYS_LIVE;
+      if (in_set != live_in[i]) {
+        live_in[i] = in_set;
+        changed = true;
+      }
+    }
+  }
+  free(live_in);
+}
+
+static bool is_dead_after(Peephole* p, int i, Reg reg) {
+  return !(p->live_out[i] & bit(reg));
+}
+
+static void delete(Inst* in) {
+  in->kind = I_NOP;
+}
+
+// mov r, r ==> (nothing)
+static bool self_move(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  if (in->kind != I_MOV || in->a.kind != OPR_REG || !is_reg(&in->b, in->a.reg))
+    return false;
+  delete(in);
+  return true;
+}
+
+// add r, 0 or sub r, 0 ==> (nothing)
+static bool add_zero(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  if ((in->kind != I_ADD && in->kind != I_SUB) || !is_imm_val(&in->b, 0))
+    return false;
+  delete(in);
+  return true;
+}
+
+// push x; pop r ==> mov r, x
+static bool push_pop(Peephole* p, int i) {
+  if (i + 1 >= p->len)
+    return false;
+  Inst* push = &p->in[i];
+  Inst* pop = &p->in[i + 1];
+  if (push->kind != I_PUSH || pop->kind != I_POP || pop->a.kind != OPR_REG)
+    return false;
+  if (push->a.kind == OPR_MEM && push->a.reg == RSP)
+    return false;
+
+  *pop = (Inst){ .kind = I_MOV, .a = pop->a, .b = push->a };
+  delete(push);
+  return true;
+}
+
+// Deletes instructions whose only effect is to write a register that
+// is not read afterwards.
+static bool dead_def(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  Reg reg;
+
+  switch (in->kind) {
+    case I_MOV:
+    case I_LEA:
+    case I_MOVZB:
+      if (in->a.kind != OPR_REG)
+        return false;
+      reg = in->a.reg;
+      break;
+    case I_SETCC:
+      reg = RAX;
+      break;
+    default:
+      return false;
+  }
+
+  if (reg == RSP || reg == RBP || !is_dead_after(p, i, reg))
+    return false;
+  delete(in);
+  return true;
+}
+
+// Returns true if `op` can be the source operand of an instruction
+// whose destination is `dst`.
+static bool can_be_source(Operand* op, Operand* dst) {
+  if (op->kind == OPR_IMM)
+    return is_imm32(op->val) || dst->kind == OPR_REG;
+  if (op->kind == OPR_MEM)
+    return dst->kind == OPR_REG;
+  return op->kind == OPR_REG;
+}
+
+// mov r, x; op y, r ==> op y, x    if r is dead afterwards
+//
+// This forwards constants, memory operands and registers into the
+// instruction that consumes them.
+static bool forward_move(Peephole* p, int i) {
+  if (i + 1 >= p->len)
+    return false;
+  Inst* mov = &p->in[i];
+  Inst* in = &p->in[i + 1];
+  if (mov->kind != I_MOV || mov->a.kind != OPR_REG)
+    return false;
+
+  Reg r = mov->a.reg;
+  Operand* x = &mov->b;
+  if (!is_dead_after(p, i + 1, r))
+    return false;
+
+  switch (in->kind) {
+    case I_MOV:
+      if (!is_reg(&in->b, r) || mentions(&in->a, r) ||
+          !can_be_source(x, &in->a))
+        return false;
+      // The full 64-bit immediate form only exists for registers.
+      in->b = *x;
+      break;
+    case I_ADD:
+    case I_SUB:
+    case I_AND:
+    case I_CMP:
+      if (!is_reg(&in->b, r) || mentions(&in->a, r) ||
+          in->a.kind != OPR_REG || !can_be_source(x, &in->a) ||
+          (x->kind == OPR_IMM && !is_imm32(x->val)))
+        return false;
+      in->b = *x;
+      break;
+    case I_IMUL:
+      if (in->c.kind != OPR_NONE || !is_reg(&in->b, r) ||
+          in->a.kind != OPR_REG || mentions(&in->a, r))
+        return false;
+      if (x->kind == OPR_IMM && is_imm32(x->val)) {
+        in->b = in->a;
+        in->c = *x;
+      } else if (x->kind == OPR_MEM || x->kind == OPR_REG) {
+        in->b = *x;
+      } else {
+        return false;
+      }
+      break;
+    case I_PUSH:
+      if (!is_reg(&in->a, r) ||
+          (x->kind == OPR_IMM && !is_imm32(x->val)))
+        return false;
+      in->a = *x;
+      break;
+    default:
+      return false;
+  }
+
+  delete(mov);
+  return true;
+}
+
+// cmp a, b; set<cc> al; movzx r, al; cmp r, 0; je L
+//   ==> cmp a, b; j<!cc> L
+static bool cond_branch(Peephole* p, int i) {
+  if (i + 4 >= p->len)
+    return false;
+  Inst* in = &p->in[i];
+  if (in[0].kind != I_CMP || in[1].kind != I_SETCC ||
+      in[2].kind != I_MOVZB || in[3].kind != I_CMP ||
+      in[4].kind != I_JCC)
+    return false;
+
+  Reg r = in[2].a.reg;
+  if (!is_reg(&in[3].a, r) || !is_imm_val(&in[3].b, 0))
+    return false;
+  if (in[4].cc != CC_E && in[4].cc != CC_NE)
+    return false;
+  if (!is_dead_after(p, i + 4, r) || !is_dead_after(p, i + 4, RAX))
+    return false;
+
+  CondCode cc = in[1].cc;
+  in[4].cc = in[4].cc == CC_E ? negate_cc(cc) : cc;
+  delete(&in[1]);
+  delete(&in[2]);
+  delete(&in[3]);
+  return true;
+}
+
+// jmp L; L: ==> L:
+static bool jump_to_next(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  if (!is_jump(in))
+    return false;
+
+  for (int j = i + 1; j < p->len && p->in[j].kind == I_LABEL; j++) {
+    if (p->in[j].a.val == in->a.val) {
+      delete(in);
+      return true;
+    }
+  }
+  return false;
+}
+
+// jmp L; ... L: jmp M ==> jmp M; ... L: jmp M
+static bool jump_thread(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  if (!is_jump(in))
+    return false;
+
+  int t = jump_target(p, in);
+  if (t < 0)
+    return false;
+  while (t < p->len && p->in[t].kind == I_LABEL)
+    t++;
+  if (t >= p->len || p->in[t].kind != I_JMP || p->in[t].a.val == in->a.val)
+    return false;
+
+  in->a = p->in[t].a;
+  return true;
+}
+
+// Deletes code that follows an unconditional jump or return and that
+// no label makes reachable.
+static bool unreachable(Peephole* p, int i) {
+  Inst* in = &p->in[i];
+  if (in->kind != I_JMP && in->kind != I_RET)
+    return false;
+
+  bool changed = false;
+  for (int j = i + 1; j < p->len && p->in[j].kind != I_LABEL; j++) {
+    delete(&p->in[j]);
+    changed = true;
+  }
+  return changed;
+}
+
+static Rule rules[] = {
+  { .name = "self-move",    .apply = self_move },
+  { .name = "add-zero",     .apply = add_zero },
+  { .name = "push-pop",     .apply = push_pop },
+  { .name = "dead-def",     .apply = dead_def },
+  { .name = "forward-move", .apply = forward_move },
+  { .name = "cond-branch",  .apply = cond_branch },
+  { .name = "jump-to-next", .apply = jump_to_next },
+  { .name = "jump-thread",  .apply = jump_thread },
+  { .name = "unreachable",  .apply = unreachable },
+};
+
+#define NUM_RULES (int)(sizeof(rules) / sizeof(*rules))
+
+static atomic_long dead_labels;
+
+// Deletes labels that no jump refers to.
+static bool delete_dead_labels(Peephole* p) {
+  HashMap used = {};
+  for (int i = 0; i < p->len; i++)
+    if (is_jump(&p->in[i]))
+      hashmap_put(&used, p->in[i].a.val, (void*)1);
+
+  bool changed = false;
+  for (int i = 0; i < p->len; i++) {
+    if (p->in[i].kind == I_LABEL && !hashmap_get(&used, p->in[i].a.val)) {
+      delete(&p->in[i]);
+      dead_labels++;
+      changed = true;
+    }
+  }
+  free(used.buckets);
+  return changed;
+}
+
+static void compact(Peephole* p) {
+  int n = 0;
+  for (int i = 0; i < p->len; i++)
+    if (p->in[i].kind != I_NOP)
+      p->in[n++] = p->in[i];
+  p->len = n;
+}
+
+static long count_insts(InstList* list) {
+  long n = 0;
+  for (int i = 0; i < list->len; i++)
+    if (list->data[i].kind != I_LABEL && list->data[i].kind != I_NOP)
+      n++;
+  return n;
+}
+
+void peephole(InstList* list) {
+  Peephole p = { .in = list->data, .len = list->len };
+  insts_before += count_insts(list);
+
+  for (bool changed = true; changed;) {
+    changed = false;
+    index_labels(&p);
+    compute_liveness(&p);
+
+    // Liveness is only valid for unmodified code, so after a rewrite
+    // skip past the instructions it may have touched.
+    for (int i = 0; i < p.len; i++) {
+      if (p.in[i].kind == I_NOP)
+        continue;
+      for (int r = 0; r < NUM_RULES; r++) {
+        if (rules[r].apply(&p, i)) {
+          rules[r].count++;
+          changed = true;
+          i += 4;
+          break;
+        }
+      }
+    }
+
+    compact(&p);
+    if (delete_dead_labels(&p)) {
+      changed = true;
+      compact(&p);
+    }
+  }
+
+  list->len = p.len;
+  free(p.live_out);
+  free(p.labels.buckets);
+  insts_after += count_insts(list);
+}
+
+void print_peephole_stats(FILE* out) {
+  fprintf(out, "peephole: %ld -> %ld instructions\n", (long)insts_before,
+          (long)insts_after);
+  for (int i = 0; i < NUM_RULES; i++)
+    fprintf(out, "  %-14s %ld\n", rules[i].name, (long)rules[i].count);
+  fprintf(out, "  %-14s %ld\n", "dead-label", (long)dead_labels);
+}
@@ -0,0 +1,91 @@
+#include "litecc.h"
+
+// Region allocator for the objects of one compilation.
+//
+// Tokens, nodes, variables, types, functions and IR are carved out
+// of large zeroed chunks with a bump pointer instead of being
+// allocated one by one, and are all released together by
+// region_free() when the compilation is over. Each thread has a
+// region of its own. Blocks too large to share a chunk get a chunk
+// of their own, which region_realloc() can grow in place.
+//
+// The bytes and objects allocated are counted per category in
+// `stats`, for --time-report and --stats.
+
+#define CHUNK_SIZE (1 << 20)
+#define LARGE_SIZE (CHUNK_SIZE / 4)
+
+typedef struct Chunk Chunk;
+struct Chunk {
+  Chunk* next;
+  long   pad;  // Keeps the data 16-byte aligned
+};
+
+static _Thread_local Chunk* chunks;
+static _Thread_local char*  ptr;
+static _Thread_local char*  end;
+
+static Chunk* new_chunk(size_t size) {
+  Chunk* c = calloc(1, sizeof(Chunk) + size);
+  if (!c)
+    error("out of memory");
+  c->next = chunks;
+  chunks = c;
+  return c;
+}
+
+// Returns `size` zeroed bytes that live until region_free().
+void* region_alloc(MemKind kind, size_t size) {
+  stats.mem_bytes[kind] += size;
+  stats.mem_objects[kind]++;
+
+  size = (size + 7) & ~7;
+  if (size >= LARGE_SIZE) {
+    Chunk* c = new_chunk(size);
+    return c + 1;
+  }
+
+  if ((size_t)(end - ptr) < size) {
+    ptr = (char*)(new_chunk(CHUNK_SIZE) + 1);
+    end = ptr + CHUNK_SIZE;
+  }
+  void* p = ptr;
+  ptr += size;
+  return p;
+}
+
+// Grows a block from `old_size` to `new_size` bytes. The new bytes
+// are zeroed.
+void* region_realloc(MemKind kind, void* p, size_t old_size, size_t new_size) {
+  if (!p || old_size < LARGE_SIZE || new_size < LARGE_SIZE) {
+    void* q = region_alloc(kind, new_size);
+    if (p)
+      memcpy(q, p, old_size);
+    stats.mem_bytes[kind] -= old_size;
+    stats.mem_objects[kind] -= p != NULL;
+    return q;
+  }
+
+  // Large blocks are chunks of their own; resize the chunk.
+  Chunk** link = &chunks;
+  while (*link != (Chunk*)p - 1)
+    link = &(*link)->next;
+  Chunk* c = realloc(*link, sizeof(Chunk) + new_size);
+  if (!c)
+    error("out of memory");
+  memset((char*)(c + 1) + old_size, 0, new_size - old_size);
+  *link = c;
+  stats.mem_bytes[kind] += new_size - old_size;
+  return c + 1;
+}
+
+// Releases everything allocated by this thread since the last call.
+void region_free(void) {
+  for (Chunk* c = chunks; c;) {
+    Chunk* next = c->next;
+    free(c);
+    c = next;
+  }
+  chunks = NULL;
+  ptr = end = NULL;
+}
@@ -0,0 +1,208 @@
+#include "litecc.h"
+
+// Compile-time and memory statistics for --time-report and --stats.
+//
+// The compiler is divided into phases. Time and heap growth are
+// charged to the innermost phase that is active, so a phase entered
+// from within another one is not counted twice. When statistics are
+// disabled, phase_begin() and phase_end() return right away.
+//
+// Each thread collects statistics of its own, which stats_flush()
+// adds to the totals. CPU time is per thread; threads that generate
+// code on behalf of another one report theirs with phase_add_cpu().
+// The heap is shared, so while several files are compiled at once
+// the heap growth of a phase also includes that of other threads.
+
+bool                stats_enabled;
+_Thread_local Stats stats;
+
+static char* phase_names[] = {
+  [PH_READ]     = "read",
+  [PH_TOKENIZE] = "tokenize",
+  [PH_PARSE]    = "parse",
+  [PH_FOLD]     = "fold",
+  [PH_DCE]      = "dce",
+  [PH_FRAME]    = "frame",
+  [PH_LOWER]    = "lower",
+  [PH_CODEGEN]  = "codegen",
+  [PH_EMIT]     = "emit",
+  [PH_WRITE]    = "write",
+};
+
+static char* mem_names[] = {
+  [MEM_TOKENS] = "tokens",
+  [MEM_NAMES]  = "names",
+  [MEM_NODES]  = "nodes",
+  [MEM_VARS]   = "vars",
+  [MEM_TYPES]  = "types",
+  [MEM_FUNCS]  = "functions",
+  [MEM_IR]     = "ir",
+};
+
+typedef struct {
+  double wall;   // Seconds
+  double cpu;    // Seconds
+  long   bytes;  // Heap growth
+} Sample;
+
+static _Thread_local Sample local[NUM_PHASES];
+static _Thread_local Phase  stack[16];
+static _Thread_local int    depth;
+static _Thread_local Sample last;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static Sample totals[NUM_PHASES];
+static Stats  counts;
+
+static double clock_seconds(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+double thread_cpu_seconds(void) {
+  return clock_seconds(CLOCK_THREAD_CPUTIME_ID);
+}
+
+// Bytes in use by malloc, including large blocks that it maps
+// directly.
+static long heap_bytes(void) {
+  struct mallinfo2 mi = mallinfo2();
+  return mi.uordblks + mi.hblkhd;
+}
+
+// Charges the time and heap growth since the last sample to the
+// current phase.
+static void charge(void) {
+  double wall = clock_seconds(CLOCK_MONOTONIC);
+  double cpu = thread_cpu_seconds();
+  long bytes = heap_bytes();
+
+  if (depth > 0) {
+    Sample* t = &local[stack[depth - 1]];
+    t->wall += wall - last.wall;
+    t->cpu += cpu - last.cpu;
+    t->bytes += bytes - last.bytes;
+  }
+  last = (Sample){ wall, cpu, bytes };
+}
+
+void phase_begin(Phase ph) {
+  if (!stats_enabled)
+    return;
+  if (depth == sizeof(stack) / sizeof(*stack))
+    error("internal error: phases nested too deeply");
+  charge();
+  stack[depth++] = ph;
+}
+
+void phase_end(void) {
+  if (!stats_enabled)
+    return;
+  charge();
+  depth--;
+}
+
+// Ends the phases that an error left unfinished.
+void reset_phases(void) {
+  if (!stats_enabled || depth == 0)
+    return;
+  charge();
+  depth = 0;
+}
+
+// Adds CPU time spent on `ph` by another thread.
+void phase_add_cpu(Phase ph, double secs) {
+  pthread_mutex_lock(&lock);
+  totals[ph].cpu += secs;
+  pthread_mutex_unlock(&lock);
+}
+
+// Adds the statistics of the calling thread to the totals.
+void stats_flush(void) {
+  pthread_mutex_lock(&lock);
+  for (int i = 0; i < NUM_PHASES; i++) {
+    totals[i].wall += local[i].wall;
+    totals[i].cpu += local[i].cpu;
+    totals[i].bytes += local[i].bytes;
+  }
+  counts.tokens += stats.tokens;
+  counts.nodes += stats.nodes;
+  counts.types += stats.types;
+  counts.vars += stats.vars;
+  counts.ir_insts += stats.ir_insts;
+  counts.insts += stats.insts;
+  for (int i = 0; i < NUM_MEM; i++) {
+    counts.mem_bytes[i] += stats.mem_bytes[i];
+    counts.mem_objects[i] += stats.mem_objects[i];
+  }
+  pthread_mutex_unlock(&lock);
+
+  memset(local, 0, sizeof(local));
+  stats = (Stats){};
+}
+
+// Returns the peak resident set size in kilobytes.
+static long peak_rss(void) {
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_maxrss;
+}
+
+static void print_text(FILE* out) {
+  Sample sum = {};
+  fprintf(out, "%-10s %10s %10s %12s\n", "phase", "wall ms", "cpu ms", "bytes");
+  for (int i = 0; i < NUM_PHASES; i++) {
+    Sample* t = &totals[i];
+    fprintf(out, "%-10s %10.2f %10.2f %12ld\n", phase_names[i],
+            t->wall * 1e3, t->cpu * 1e3, t->bytes);
+    sum.wall += t->wall;
+    sum.cpu += t->cpu;
+    sum.bytes += t->bytes;
+  }
+  fprintf(out, "%-10s %10.2f %10.2f %12ld\n", "total",
+          sum.wall * 1e3, sum.cpu * 1e3, sum.bytes);
+
+  fprintf(out, "tokens %ld, nodes %ld, types %ld, vars %ld, "
+               "ir instructions %ld, instructions %ld\n",
+          counts.tokens, counts.nodes, counts.types, counts.vars,
+          counts.ir_insts, counts.insts);
+
+  fprintf(out, "%-10s %12s %10s\n", "memory", "bytes", "objects");
+  for (int i = 0; i < NUM_MEM; i++)
+    fprintf(out, "%-10s %12ld %10ld\n", mem_names[i],
+            counts.mem_bytes[i], counts.mem_objects[i]);
+  fprintf(out, "peak rss %ld KiB\n", peak_rss());
+}
+
+static void print_json(FILE* out) {
+  fprintf(out, "{\n  \"phases\": {\n");
+  for (int i = 0; i < NUM_PHASES; i++) {
+    Sample* t = &totals[i];
+    fprintf(out, "    \"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f, "
+                 "\"bytes\": %ld}%s\n", phase_names[i], t->wall * 1e3,
+            t->cpu * 1e3, t->bytes, i < NUM_PHASES - 1 ? "," : "");
+  }
+  fprintf(out, "  },\n");
+  fprintf(out, "  \"counts\": {\"tokens\": %ld, \"nodes\": %ld, "
+               "\"types\": %ld, \"vars\": %ld, \"ir_insts\": %ld, "
+               "\"insts\": %ld},\n",
+          counts.tokens, counts.nodes, counts.types, counts.vars,
+          counts.ir_insts, counts.insts);
+  fprintf(out, "  \"memory\": {\n");
+  for (int i = 0; i < NUM_MEM; i++)
+    fprintf(out, "    \"%s\": {\"bytes\": %ld, \"objects\": %ld}%s\n",
+            mem_names[i], counts.mem_bytes[i], counts.mem_objects[i],
+            i < NUM_MEM - 1 ? "," : "");
+  fprintf(out, "  },\n");
+  fprintf(out, "  \"peak_rss_kb\": %ld\n}\n", peak_rss());
+}
+
+// Prints the report as text, or as JSON if `json` is true. Only
+// flushed statistics are included.
+void print_stats(FILE* out, bool json) {
+  if (json)
+    print_json(out);
+  else
+    print_text(out);
+}
@@ -1,5 +1,19 @@
 #!/bin/bash
-cat <<EOF | gcc -xc -c -o tmp2.o -
+
+# By default, tests are compiled to objects with -c and linked into
+# executables. With --asm, they are compiled to assembly and
+# assembled by gcc instead. With --run, they are run in-process by
+# litecc. With --batch, they are all compiled by one litecc
+# invocation and linked into one driver program. Other arguments,
+# such as -O0, are passed to every litecc invocation.
+mode=link
+if [ "$1" = --asm ] || [ "$1" = --run ] || [ "$1" = --batch ]; then
+  mode=${1#--}
+  shift
+fi
+flags="$@"
+
+cat <<EOF > tmp2.c
 int ret3() { return 3; }
 int ret5() { return 5; }
 int add(int x, int y) { return x+y; }
@@ -9,15 +23,13 @@ int add6(int a, int b, int c, int d, int e, int f) {
   return a+b+c+d+e+f;
 }
 EOF
+gcc -c -o tmp2.o tmp2.c
+gcc -shared -fPIC -o tmp2.so tmp2.c
 
-assert() {
+check() {
   expected="$1"
   input="$2"
-
-  ./litecc "$input" > tmp.s
-  gcc -static -o tmp tmp.s tmp2.o
-  ./tmp
-  actual="$?"
+  actual="$3"
 
   if [ "$actual" = "$expected" ]; then
     echo "$input => $actual"
@@ -27,6 +39,80 @@ assert() {
   fi
 }
 
+assert() {
+  expected="$1"
+  input="$2"
+
+  if [ "$mode" = batch ]; then
+    batch_expected+=("$expected")
+    batch_input+=("$input")
+    return
+  elif [ "$mode" = run ]; then
+    echo "$input" | ./litecc $flags --run --load ./tmp2.so -
+    actual="$?"
+  elif [ "$mode" = asm ]; then
+    echo "$input" | ./litecc $flags -S -o tmp.s - || exit
+    gcc -static -o tmp tmp.s tmp2.o
+    ./tmp
+    actual="$?"
+  else
+    echo "$input" | ./litecc $flags -c -o tmp.o - || exit
+    gcc -static -o tmp tmp.o tmp2.o
+    ./tmp
+    actual="$?"
+  fi
+  check "$expected" "$input" "$actual"
+}
+
+now_ms() {
+  echo $(( $(date +%s%N) / 1000000 ))
+}
+
+# In batch mode, compiles the tests collected by assert() with one
+# litecc invocation, in which each test's main becomes _c<i>_main,
+# and links them with one gcc invocation into a driver that runs
+# them all.
+run_batch() {
+  [ "$mode" = batch ] || return 0
+  n=${#batch_input[@]}
+
+  for ((i = 0; i < n; i++)); do
+    [ $i -gt 0 ] && echo '%%'
+    echo "${batch_input[$i]}"
+  done > tmp.c
+
+  {
+    echo '#include <stdio.h>'
+    for ((i = 0; i < n; i++)); do
+      echo "long _c${i}_main(void);"
+    done
+    echo 'long (*tests[])(void) = {'
+    for ((i = 0; i < n; i++)); do
+      echo "  _c${i}_main,"
+    done
+    echo '};'
+    echo 'int main() {'
+    echo '  for (int i = 0; i < sizeof(tests) / sizeof(*tests); i++) {'
+    echo '    printf("%d\n", (int)(tests[i]() & 255));'
+    echo '    fflush(stdout);'
+    echo '  }'
+    echo '}'
+  } > tmp_driver.c
+
+  t0=$(now_ms)
+  ./litecc $flags --batch -c -o tmp.o tmp.c || exit
+  t1=$(now_ms)
+  gcc -static -o tmp tmp_driver.c tmp.o tmp2.o || exit
+  t2=$(now_ms)
+  mapfile -t results < <(./tmp)
+  t3=$(now_ms)
+
+  for ((i = 0; i < n; i++)); do
+    check "${batch_expected[$i]}" "${batch_input[$i]}" "${results[$i]}"
+  done
+  echo "batch: $n tests, compile $((t1 - t0)) ms, link $((t2 - t1)) ms, run $((t3 - t2)) ms"
+}
+
 assert 0 'int main() { return 0; }'
 assert 42 'int main() { return 42; }'
 assert 21 'int main() { return 5+20-4; }'
@@ -91,8 +177,21 @@ assert 21 'int main() { return add6(1,2,3,4,5,6); }'
 assert 32 'int main() { return ret32(); } int ret32() { return 32; }'
 assert 7 'int main() { return add2(3,4); } int add2(int x, int y) { return x+y; }'
 assert 1 'int main() { return sub2(4,3); } int sub2(int x, int y) { return x-y; }'
+assert 10 'int main() { return add2(add2(1,2), (add2(3,(4)))); } int add2(int x, int y) { return x+y; }'
 assert 55 'int main() { return fib(9); } int fib(int x) { if (x<=1) return 1; return fib(x-1) + fib(x-2); }'
 
+assert 15 'int main() { return 1+(2+(3+add(4,5))); }'
+assert 12 'int main() { int x=1; int y=2; return x*(y+(x+add(y,sub(5,x)))+y+add6(x,y,3,4,5,6)-20); }'
+
+# Expressions that need more registers than there are.
+e=1; for i in 1 2 3 4 5 6 7 8 9; do e="($e+$e)"; done
+assert 0 "int main() { return $e-512; }"
+e=ret3; for i in 1 2 3 4 5 6 7 8 9; do e="($e*1+$e)"; done
+e=${e//ret3/ret3()}
+assert 6 "int main() { return $e-1530; }"
+e=x; for i in 1 2 3 4 5 6 7 8 9; do e="($e-(1-$e)/1)"; done
+assert 1 "int main() { int x=1; return $e; }"
+
 assert 3 'int main() { int x=3; return *&x; }'
 assert 3 'int main() { int x=3; int *y=&x; int **z=&y; return **z; }'
 assert 5 'int main() { int x=3; int y=5; return *(&x+1); }'
@@ -102,6 +201,9 @@ assert 2 'int main() { int x=3; return (&x+2)-&x; }'
 assert 5 'int main() { int x=3; int y=5; int *z=&x; return *(z+1); }'
 assert 3 'int main() { int x=3; int y=5; int *z=&y; return *(z-1); }'
 assert 5 'int main() { int x=3; int *y=&x; *y=5; return x; }'
+assert 1 'int main() { int x=1; { int x=2; } return x; }'
+assert 2 'int main() { int x=1; { int x=2; return x; } }'
+assert 7 'int main() { int x=3; { int a[2]; a[1]=4; x=x+a[1]; } { int b; b=0; x=x+b; } return x; }'
 assert 7 'int main() { int x=3; int y=5; *(&x+1)=7; return y; }'
 assert 7 'int main() { int x=3; int y=5; *(&y-1)=7; return x; }'
 assert 8 'int main() { int x=3; int y=5; return foo(&x, y); } int foo(int *x, int y) { return *x + y; }'
@@ -144,6 +246,20 @@ assert 8 'int main() { int x[3][4]; return sizeof(**x); }'
 assert 9 'int main() { int x[3][4]; return sizeof(**x) + 1; }'
 assert 9 'int main() { int x[3][4]; return sizeof **x + 1; }'
 assert 8 'int main() { int x[3][4]; return sizeof(**x + 1); }'
+assert 3 'int main() { int x[2]; int y; x[1]=5; y=x[0]=2; return -x[0]+x[1]; }'
+
+assert 33 'int main() { int x; return sizeof(x)*4+1; }'
+assert 2 'int main() { while (0) return 1; return 2; }'
+assert 4 'int main() { int i=4; for (; 0;) return 1; return i; }'
+assert 3 'int main() { return -(-(3)); }'
+assert 5 'int main() { int a=5; return a*1+0-a*0+(a-a)*0; }'
+assert 1 'int g; int inc() { g=g+1; return g; } int main() { g=0; inc()*0; return g; }'
+assert 6 'int main() { int x[2][3]; x[1][2]=6; return *(*(x+1)+2); }'
+assert 7 'int x[2][3]; int main() { x[1][2]=7; return *(x[1]+2); }'
+assert 9 'int main() { int x=3; int y=9; return *(&x+2-1); }'
+assert 254 'int main() { return (9223372036854775807 + 1) / 4611686018427387904; }'
+assert 247 'int main() { return 3037000500 * 3037000500 / 1000000000000000000; }'
+assert 1 'int main() { int x; x=1; return (x + 9223372036854775807) + 1 < 0; }'
 
 assert 0 'int x; int main() { return x; }'
 assert 3 'int x; int main() { x=3; return x; }'
@@ -153,6 +269,167 @@ assert 2 'int x[4]; int main() { x[0]=0; x[1]=1; x[2]=2; x[3]=3; return x[2]; }'
 assert 3 'int x[4]; int main() { x[0]=0; x[1]=1; x[2]=2; x[3]=3; return x[3]; }'
 
 assert 8 'int x; int main() { return sizeof(x); }'
+assert 3 'int x; int main() { int x; x=3; return x; }'
+assert 5 'int x; int main() { int x; x=3; return f(); } int f() { x=5; return x; }'
+assert 7 'int x; int main() { x=7; return f(); } int f() { return x; }'
+assert 2 'int main() { int a=1; return f(2); } int f(int a) { return a; }'
+assert 3 'int x; int f(int x) { return x; } int main() { x=5; return f(3); }'
 assert 32 'int x[4]; int main() { return sizeof(x); }'
+assert 21 'int main() { return add(1,2)*add(3,4); }'
+assert 23 'int main() { int a; a=2; return a*3 + ret3()*ret5() + a; }'
+assert 30 'int main() { return ret3()+(ret5()+(ret3()+(ret5()+(ret3()+(ret5()+(ret3()+(ret5()+ret3()-ret5()))))))); }'
+assert 4 'int main() { int x; x=0; for (;;) { x=x+1; if (x==4) return x; } }'
+assert 9 'int main() { return 9; return 1; }'
+assert 4 'int g; int main() { int y; y = (g = 4); return g; }'
+assert 2 'int main() { int a; int b; a = 1; b = a; { return 2; a = 3; } return a; }'
+assert 6 'int main() { int a; int b; a = 5; b = 6; return *(&a+1); }'
+
+run_batch
+
+# Read the source from a mapped file instead of stdin.
+echo 'int main() { return 42; }' > tmp.c
+./litecc $flags -o tmp.s tmp.c || exit
+gcc -static -o tmp tmp.s tmp2.o
+./tmp
+[ "$?" = 42 ] || { echo "file input failed"; exit 1; }
+echo "tmp.c => 42"
+
+# A file whose size is an exact multiple of the page size must
+# still be terminated for the tokenizer.
+size=$(getconf PAGESIZE)
+{ printf 'int main() { return 7; }'; head -c $((size - 25)) /dev/zero | tr '\0' ' '; echo; } > tmp.c
+./litecc $flags -o tmp.s tmp.c || exit
+gcc -static -o tmp tmp.s tmp2.o
+./tmp
+[ "$?" = 7 ] || { echo "page-sized input failed"; exit 1; }
+echo "page-sized tmp.c => 7"
+
+# The IR dump shows the lowered control flow.
+echo 'int main() { int x; x=1; while (x<5) x=x+1; return x; }' > tmp.c
+./litecc --dump-ir tmp.c | grep -q 'br v[0-9]*, bb[0-9]*, bb[0-9]*' ||
+  { echo "--dump-ir failed"; exit 1; }
+echo "--dump-ir => OK"
+
+# An offset too large for an immediate is computed, not dropped.
+echo 'int main() { int x; int *p; p = &x; return *(p + 4611686018427387904); }' > tmp.c
+./litecc --dump-ir tmp.c | grep -q 'imm 4611686018427387904$' ||
+  { echo "large offset failed"; exit 1; }
+echo "large offset => OK"
+
+# Deeply nested expressions compile in a small native stack.
+awk 'BEGIN {
+  n = 100000
+  printf "int f(int x) { return x; }\nint main() { int x; x = "
+  for (i = 0; i < n; i++) printf "("
+  printf "1"
+  for (i = 0; i < n; i++) printf ")"
+  printf "; x = x + "
+  for (i = 0; i < n; i++) printf "- "
+  printf "2; x = x + "
+  for (i = 0; i < n; i++) printf "*&"
+  printf "x; x = x + "
+  for (i = 0; i < n; i++) printf "f("
+  printf "1"
+  for (i = 0; i < n; i++) printf ")"
+  printf "; return x; }\n"
+}' > tmp.c
+(ulimit -s 1024; ./litecc $flags -o tmp.s tmp.c) || { echo "deep nesting failed"; exit 1; }
+gcc -static -o tmp tmp.s tmp2.o
+./tmp
+[ "$?" = 7 ] || { echo "deep nesting failed"; exit 1; }
+echo "deep nesting => 7"
+
+# Sibling blocks share their variables' stack slots.
+awk 'BEGIN {
+  printf "int main() { int x; x = 0;"
+  for (i = 0; i < 1000; i++) printf " { int t[4]; t[3] = x; x = t[3] + 1; }"
+  printf " return x; }\n"
+}' > tmp.c
+./litecc -o tmp.s tmp.c && grep -q 'sub rsp, 48$' tmp.s ||
+  { echo "block frame layout failed"; exit 1; }
+echo "block frame layout => OK"
+
+# Variables that are never read get no stack slot.
+echo 'int main() { int x; int y[8]; int z; x = 3; y[2] = x; z = x * 2; return x; }' > tmp.c
+./litecc -o tmp.s tmp.c && grep -q 'sub rsp, 16$' tmp.s ||
+  { echo "dead variable elimination failed"; exit 1; }
+echo "dead variable elimination => OK"
+
+# An access far outside a variable keeps the other variables.
+echo 'int main() { int x; int y; x = 1; y = 2; return *(&x + 1152921504606846975); }' > tmp.c
+./litecc --dump-ir tmp.c | grep -q 'store y,' ||
+  { echo "out-of-bounds access failed"; exit 1; }
+echo "out-of-bounds access => OK"
+
+# Code generated on several threads is the same as on one.
+bench/gen.sh funcs 0.01 > tmp.c
+./litecc -j 1 -o tmp.s tmp.c && ./litecc -j 4 -o tmp-j.s tmp.c && cmp -s tmp.s tmp-j.s &&
+  ./litecc -j 1 -c -o tmp.o tmp.c && ./litecc -j 4 -c -o tmp-j.o tmp.c && cmp -s tmp.o tmp-j.o ||
+  { echo "-j 4 output differs"; exit 1; }
+echo "-j 4 => OK"
+
+# Several files are compiled into one output each. An error in one
+# file does not stop the others.
+echo 'int main() { return 3; }' > tmp-a.c
+echo 'int main() { return x; }' > tmp-b.c
+echo 'int f() { return 4; }' > tmp-c.c
+./litecc -j 2 -c tmp-a.c tmp-b.c tmp-c.c 2> tmp-err.txt &&
+  { echo "multiple files: error not reported"; exit 1; }
+grep -q '^tmp-b.c:1: ' tmp-err.txt && [ -f tmp-a.o ] && [ -f tmp-c.o ] &&
+  gcc -static -o tmp tmp-a.o tmp-c.o && { ./tmp; [ "$?" = 3 ]; } ||
+  { echo "multiple files failed"; exit 1; }
+echo "tmp-a.c tmp-b.c tmp-c.c => OK"
+
+# Each output is named after its input, so stdin is not one of them.
+echo 'int main() { return 3; }' | ./litecc -c tmp-a.c - 2> /dev/null &&
+  { echo "multiple files: - accepted"; exit 1; }
+
+# Errors leave nothing behind for the files that follow, even with
+# phases being timed.
+for i in $(seq 20); do
+  case $((i % 3)) in
+    0) echo 'int main() { return 1 + (2 * x); }' ;;
+    1) echo 'int main() { int a; (a + 1) = 2; return a; }' ;;
+    2) echo 'int main() { return (1 + ; }' ;;
+  esac > tmp-e$i.c
+done
+rm -f tmp-a.o
+./litecc -j 1 --time-report -c tmp-e*.c tmp-a.c 2> tmp-err.txt
+[ "$(grep -c '^tmp-e' tmp-err.txt)" = 20 ] && [ -f tmp-a.o ] ||
+  { echo "multiple files with errors failed"; exit 1; }
+echo "multiple files with errors => OK"
+
+# Functions whose code is cached are not compiled again, and only
+# changed functions miss the cache.
+rm -rf tmp-cache
+bench/gen.sh funcs 0.01 > tmp.c
+./litecc -o tmp.s tmp.c &&
+  ./litecc --cache-dir=tmp-cache -o tmp-j.s tmp.c && cmp -s tmp.s tmp-j.s &&
+  ./litecc --cache-dir=tmp-cache --cache-stats -o tmp-j.s tmp.c 2> tmp-err.txt &&
+  cmp -s tmp.s tmp-j.s && grep -q ' 0 misses' tmp-err.txt &&
+  sed '1s/a + b/a + b + 1/' tmp.c > tmp-a.c &&
+  ./litecc --cache-dir=tmp-cache --cache-stats -o tmp-j.s tmp-a.c 2> tmp-err.txt &&
+  ./litecc -o tmp.s tmp-a.c && cmp -s tmp.s tmp-j.s &&
+  grep -q ' 200 hits, 1 misses' tmp-err.txt ||
+  { echo "--cache-dir failed"; exit 1; }
+echo "--cache-dir => OK"
+
+echo 'int main() { int x; x=1; while (x<5) x=x+1; return x; }' > tmp.c
+
+# Statistics report on every phase, as text and as JSON.
+./litecc --time-report -o /dev/null tmp.c 2>&1 | grep -q '^codegen ' ||
+  { echo "--time-report failed"; exit 1; }
+./litecc --stats=tmp.json -o /dev/null tmp.c &&
+  grep -q '"tokens": 28,' tmp.json &&
+  grep -q '"nodes": {"bytes": [1-9][0-9]*, "objects": 17}' tmp.json ||
+  { echo "--stats failed"; exit 1; }
+echo "--stats => OK"
+
+# Each distinct type is created once.
+echo 'int main() { int *p; int *q; int a[2][3]; int b[2][3]; p=&a[0][0]; q=&b[1][2]; return *&*p; }' > tmp.c
+./litecc --stats=tmp.json -o /dev/null tmp.c &&
+  grep -q '"types": 3,' tmp.json ||
+  { echo "type interning failed"; exit 1; }
+echo "type interning => OK"
 
 echo OK
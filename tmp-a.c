@@ -0,0 +1,997 @@
+int f0(int a, int b) { return a + b + 1; }
+int f1(int a, int b) {
+  int x; x = f0(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f2(int a, int b) {
+  int x; x = f1(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f3(int a, int b) {
+  int x; x = f2(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f4(int a, int b) {
+  int x; x = f3(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f5(int a, int b) {
+  int x; x = f4(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f6(int a, int b) {
+  int x; x = f5(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f7(int a, int b) {
+  int x; x = f6(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f8(int a, int b) {
+  int x; x = f7(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f9(int a, int b) {
+  int x; x = f8(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f10(int a, int b) {
+  int x; x = f9(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f11(int a, int b) {
+  int x; x = f10(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f12(int a, int b) {
+  int x; x = f11(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f13(int a, int b) {
+  int x; x = f12(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f14(int a, int b) {
+  int x; x = f13(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f15(int a, int b) {
+  int x; x = f14(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f16(int a, int b) {
+  int x; x = f15(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f17(int a, int b) {
+  int x; x = f16(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f18(int a, int b) {
+  int x; x = f17(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f19(int a, int b) {
+  int x; x = f18(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f20(int a, int b) {
+  int x; x = f19(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f21(int a, int b) {
+  int x; x = f20(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f22(int a, int b) {
+  int x; x = f21(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f23(int a, int b) {
+  int x; x = f22(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f24(int a, int b) {
+  int x; x = f23(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f25(int a, int b) {
+  int x; x = f24(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f26(int a, int b) {
+  int x; x = f25(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f27(int a, int b) {
+  int x; x = f26(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f28(int a, int b) {
+  int x; x = f27(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f29(int a, int b) {
+  int x; x = f28(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f30(int a, int b) {
+  int x; x = f29(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f31(int a, int b) {
+  int x; x = f30(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f32(int a, int b) {
+  int x; x = f31(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f33(int a, int b) {
+  int x; x = f32(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f34(int a, int b) {
+  int x; x = f33(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f35(int a, int b) {
+  int x; x = f34(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f36(int a, int b) {
+  int x; x = f35(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f37(int a, int b) {
+  int x; x = f36(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f38(int a, int b) {
+  int x; x = f37(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f39(int a, int b) {
+  int x; x = f38(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f40(int a, int b) {
+  int x; x = f39(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f41(int a, int b) {
+  int x; x = f40(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f42(int a, int b) {
+  int x; x = f41(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f43(int a, int b) {
+  int x; x = f42(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f44(int a, int b) {
+  int x; x = f43(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f45(int a, int b) {
+  int x; x = f44(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f46(int a, int b) {
+  int x; x = f45(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f47(int a, int b) {
+  int x; x = f46(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f48(int a, int b) {
+  int x; x = f47(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f49(int a, int b) {
+  int x; x = f48(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f50(int a, int b) {
+  int x; x = f49(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f51(int a, int b) {
+  int x; x = f50(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f52(int a, int b) {
+  int x; x = f51(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f53(int a, int b) {
+  int x; x = f52(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f54(int a, int b) {
+  int x; x = f53(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f55(int a, int b) {
+  int x; x = f54(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f56(int a, int b) {
+  int x; x = f55(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f57(int a, int b) {
+  int x; x = f56(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f58(int a, int b) {
+  int x; x = f57(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f59(int a, int b) {
+  int x; x = f58(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f60(int a, int b) {
+  int x; x = f59(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f61(int a, int b) {
+  int x; x = f60(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f62(int a, int b) {
+  int x; x = f61(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f63(int a, int b) {
+  int x; x = f62(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f64(int a, int b) {
+  int x; x = f63(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f65(int a, int b) {
+  int x; x = f64(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f66(int a, int b) {
+  int x; x = f65(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f67(int a, int b) {
+  int x; x = f66(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f68(int a, int b) {
+  int x; x = f67(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f69(int a, int b) {
+  int x; x = f68(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f70(int a, int b) {
+  int x; x = f69(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f71(int a, int b) {
+  int x; x = f70(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f72(int a, int b) {
+  int x; x = f71(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f73(int a, int b) {
+  int x; x = f72(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f74(int a, int b) {
+  int x; x = f73(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f75(int a, int b) {
+  int x; x = f74(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f76(int a, int b) {
+  int x; x = f75(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f77(int a, int b) {
+  int x; x = f76(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f78(int a, int b) {
+  int x; x = f77(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f79(int a, int b) {
+  int x; x = f78(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f80(int a, int b) {
+  int x; x = f79(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f81(int a, int b) {
+  int x; x = f80(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f82(int a, int b) {
+  int x; x = f81(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f83(int a, int b) {
+  int x; x = f82(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f84(int a, int b) {
+  int x; x = f83(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f85(int a, int b) {
+  int x; x = f84(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f86(int a, int b) {
+  int x; x = f85(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f87(int a, int b) {
+  int x; x = f86(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f88(int a, int b) {
+  int x; x = f87(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f89(int a, int b) {
+  int x; x = f88(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f90(int a, int b) {
+  int x; x = f89(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f91(int a, int b) {
+  int x; x = f90(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f92(int a, int b) {
+  int x; x = f91(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f93(int a, int b) {
+  int x; x = f92(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f94(int a, int b) {
+  int x; x = f93(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f95(int a, int b) {
+  int x; x = f94(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f96(int a, int b) {
+  int x; x = f95(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f97(int a, int b) {
+  int x; x = f96(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f98(int a, int b) {
+  int x; x = f97(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f99(int a, int b) {
+  int x; x = f98(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f100(int a, int b) {
+  int x; x = f99(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f101(int a, int b) {
+  int x; x = f100(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f102(int a, int b) {
+  int x; x = f101(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f103(int a, int b) {
+  int x; x = f102(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f104(int a, int b) {
+  int x; x = f103(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f105(int a, int b) {
+  int x; x = f104(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f106(int a, int b) {
+  int x; x = f105(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f107(int a, int b) {
+  int x; x = f106(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f108(int a, int b) {
+  int x; x = f107(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f109(int a, int b) {
+  int x; x = f108(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f110(int a, int b) {
+  int x; x = f109(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f111(int a, int b) {
+  int x; x = f110(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f112(int a, int b) {
+  int x; x = f111(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f113(int a, int b) {
+  int x; x = f112(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f114(int a, int b) {
+  int x; x = f113(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f115(int a, int b) {
+  int x; x = f114(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f116(int a, int b) {
+  int x; x = f115(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f117(int a, int b) {
+  int x; x = f116(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f118(int a, int b) {
+  int x; x = f117(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f119(int a, int b) {
+  int x; x = f118(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f120(int a, int b) {
+  int x; x = f119(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f121(int a, int b) {
+  int x; x = f120(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f122(int a, int b) {
+  int x; x = f121(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f123(int a, int b) {
+  int x; x = f122(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f124(int a, int b) {
+  int x; x = f123(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f125(int a, int b) {
+  int x; x = f124(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f126(int a, int b) {
+  int x; x = f125(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f127(int a, int b) {
+  int x; x = f126(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f128(int a, int b) {
+  int x; x = f127(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f129(int a, int b) {
+  int x; x = f128(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f130(int a, int b) {
+  int x; x = f129(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f131(int a, int b) {
+  int x; x = f130(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f132(int a, int b) {
+  int x; x = f131(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f133(int a, int b) {
+  int x; x = f132(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f134(int a, int b) {
+  int x; x = f133(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f135(int a, int b) {
+  int x; x = f134(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f136(int a, int b) {
+  int x; x = f135(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f137(int a, int b) {
+  int x; x = f136(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f138(int a, int b) {
+  int x; x = f137(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f139(int a, int b) {
+  int x; x = f138(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f140(int a, int b) {
+  int x; x = f139(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f141(int a, int b) {
+  int x; x = f140(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f142(int a, int b) {
+  int x; x = f141(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f143(int a, int b) {
+  int x; x = f142(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f144(int a, int b) {
+  int x; x = f143(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f145(int a, int b) {
+  int x; x = f144(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f146(int a, int b) {
+  int x; x = f145(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f147(int a, int b) {
+  int x; x = f146(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f148(int a, int b) {
+  int x; x = f147(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f149(int a, int b) {
+  int x; x = f148(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f150(int a, int b) {
+  int x; x = f149(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f151(int a, int b) {
+  int x; x = f150(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f152(int a, int b) {
+  int x; x = f151(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f153(int a, int b) {
+  int x; x = f152(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f154(int a, int b) {
+  int x; x = f153(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f155(int a, int b) {
+  int x; x = f154(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f156(int a, int b) {
+  int x; x = f155(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f157(int a, int b) {
+  int x; x = f156(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f158(int a, int b) {
+  int x; x = f157(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f159(int a, int b) {
+  int x; x = f158(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f160(int a, int b) {
+  int x; x = f159(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f161(int a, int b) {
+  int x; x = f160(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f162(int a, int b) {
+  int x; x = f161(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f163(int a, int b) {
+  int x; x = f162(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f164(int a, int b) {
+  int x; x = f163(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f165(int a, int b) {
+  int x; x = f164(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f166(int a, int b) {
+  int x; x = f165(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f167(int a, int b) {
+  int x; x = f166(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f168(int a, int b) {
+  int x; x = f167(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f169(int a, int b) {
+  int x; x = f168(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f170(int a, int b) {
+  int x; x = f169(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f171(int a, int b) {
+  int x; x = f170(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f172(int a, int b) {
+  int x; x = f171(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f173(int a, int b) {
+  int x; x = f172(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f174(int a, int b) {
+  int x; x = f173(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f175(int a, int b) {
+  int x; x = f174(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f176(int a, int b) {
+  int x; x = f175(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f177(int a, int b) {
+  int x; x = f176(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f178(int a, int b) {
+  int x; x = f177(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f179(int a, int b) {
+  int x; x = f178(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f180(int a, int b) {
+  int x; x = f179(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f181(int a, int b) {
+  int x; x = f180(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f182(int a, int b) {
+  int x; x = f181(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f183(int a, int b) {
+  int x; x = f182(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f184(int a, int b) {
+  int x; x = f183(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f185(int a, int b) {
+  int x; x = f184(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f186(int a, int b) {
+  int x; x = f185(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f187(int a, int b) {
+  int x; x = f186(b, a / 7) + 5;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f188(int a, int b) {
+  int x; x = f187(b, a / 7) + 6;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f189(int a, int b) {
+  int x; x = f188(b, a / 7) + 7;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f190(int a, int b) {
+  int x; x = f189(b, a / 7) + 8;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f191(int a, int b) {
+  int x; x = f190(b, a / 7) + 9;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f192(int a, int b) {
+  int x; x = f191(b, a / 7) + 10;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f193(int a, int b) {
+  int x; x = f192(b, a / 7) + 11;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f194(int a, int b) {
+  int x; x = f193(b, a / 7) + 12;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f195(int a, int b) {
+  int x; x = f194(b, a / 7) + 0;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f196(int a, int b) {
+  int x; x = f195(b, a / 7) + 1;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f197(int a, int b) {
+  int x; x = f196(b, a / 7) + 2;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f198(int a, int b) {
+  int x; x = f197(b, a / 7) + 3;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int f199(int a, int b) {
+  int x; x = f198(b, a / 7) + 4;
+  if (x > 1000) x = x - 1000;
+  return x;
+}
+int main() { f199(1, 2); return 0; }
@@ -0,0 +1 @@
+int main() { int a; (a + 1) = 2; return a; }
@@ -0,0 +1 @@
+int main() { int *p; int *q; int a[2][3]; int b[2][3]; p=&a[0][0]; q=&b[1][2]; return *&*p; }
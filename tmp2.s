@@ -0,0 +1,6169 @@
+.intel_syntax noprefix
+.data
+.text
+.global f0
+f0:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov qword ptr [rbp-16], rdi
+  mov qword ptr [rbp-8], rsi
+  mov r10, qword ptr [rbp-16]
+  add r10, qword ptr [rbp-8]
+  mov rax, r10
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1
+f1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f0
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f1.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f1.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f2
+f2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f1
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f2.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f2.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f3
+f3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f2
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f3.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f3.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f4
+f4:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f3
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f4.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f4.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f5
+f5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f4
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f5.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f5.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f6
+f6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f5
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f6.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f6.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f7
+f7:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f6
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f7.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f7.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f8
+f8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f7
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f8.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f8.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f9
+f9:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f8
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f9.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f9.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f10
+f10:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f9
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f10.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f10.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f11
+f11:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f10
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f11.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f11.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f12
+f12:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f11
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f12.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f12.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f13
+f13:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f12
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f13.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f13.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f14
+f14:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f13
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f14.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f14.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f15
+f15:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f14
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f15.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f15.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f16
+f16:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f15
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f16.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f16.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f17
+f17:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f16
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f17.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f17.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f18
+f18:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f17
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f18.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f18.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f19
+f19:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f18
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f19.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f19.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f20
+f20:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f19
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f20.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f20.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f21
+f21:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f20
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f21.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f21.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f22
+f22:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f21
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f22.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f22.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f23
+f23:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f22
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f23.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f23.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f24
+f24:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f23
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f24.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f24.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f25
+f25:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f24
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f25.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f25.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f26
+f26:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f25
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f26.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f26.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f27
+f27:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f26
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f27.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f27.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f28
+f28:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f27
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f28.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f28.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f29
+f29:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f28
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f29.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f29.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f30
+f30:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f29
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f30.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f30.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f31
+f31:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f30
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f31.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f31.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f32
+f32:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f31
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f32.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f32.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f33
+f33:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f32
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f33.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f33.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f34
+f34:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f33
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f34.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f34.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f35
+f35:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f34
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f35.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f35.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f36
+f36:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f35
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f36.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f36.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f37
+f37:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f36
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f37.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f37.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f38
+f38:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f37
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f38.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f38.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f39
+f39:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f38
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f39.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f39.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f40
+f40:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f39
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f40.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f40.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f41
+f41:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f40
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f41.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f41.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f42
+f42:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f41
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f42.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f42.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f43
+f43:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f42
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f43.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f43.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f44
+f44:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f43
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f44.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f44.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f45
+f45:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f44
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f45.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f45.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f46
+f46:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f45
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f46.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f46.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f47
+f47:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f46
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f47.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f47.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f48
+f48:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f47
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f48.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f48.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f49
+f49:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f48
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f49.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f49.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f50
+f50:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f49
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f50.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f50.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f51
+f51:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f50
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f51.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f51.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f52
+f52:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f51
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f52.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f52.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f53
+f53:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f52
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f53.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f53.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f54
+f54:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f53
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f54.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f54.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f55
+f55:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f54
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f55.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f55.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f56
+f56:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f55
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f56.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f56.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f57
+f57:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f56
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f57.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f57.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f58
+f58:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f57
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f58.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f58.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f59
+f59:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f58
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f59.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f59.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f60
+f60:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f59
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f60.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f60.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f61
+f61:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f60
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f61.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f61.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f62
+f62:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f61
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f62.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f62.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f63
+f63:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f62
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f63.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f63.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f64
+f64:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f63
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f64.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f64.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f65
+f65:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f64
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f65.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f65.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f66
+f66:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f65
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f66.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f66.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f67
+f67:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f66
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f67.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f67.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f68
+f68:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f67
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f68.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f68.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f69
+f69:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f68
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f69.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f69.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f70
+f70:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f69
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f70.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f70.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f71
+f71:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f70
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f71.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f71.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f72
+f72:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f71
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f72.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f72.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f73
+f73:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f72
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f73.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f73.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f74
+f74:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f73
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f74.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f74.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f75
+f75:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f74
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f75.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f75.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f76
+f76:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f75
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f76.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f76.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f77
+f77:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f76
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f77.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f77.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f78
+f78:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f77
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f78.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f78.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f79
+f79:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f78
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f79.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f79.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f80
+f80:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f79
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f80.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f80.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f81
+f81:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f80
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f81.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f81.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f82
+f82:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f81
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f82.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f82.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f83
+f83:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f82
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f83.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f83.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f84
+f84:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f83
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f84.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f84.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f85
+f85:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f84
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f85.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f85.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f86
+f86:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f85
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f86.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f86.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f87
+f87:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f86
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f87.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f87.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f88
+f88:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f87
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f88.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f88.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f89
+f89:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f88
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f89.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f89.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f90
+f90:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f89
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f90.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f90.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f91
+f91:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f90
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f91.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f91.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f92
+f92:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f91
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f92.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f92.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f93
+f93:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f92
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f93.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f93.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f94
+f94:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f93
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f94.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f94.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f95
+f95:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f94
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f95.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f95.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f96
+f96:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f95
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f96.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f96.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f97
+f97:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f96
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f97.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f97.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f98
+f98:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f97
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f98.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f98.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f99
+f99:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f98
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f99.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f99.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f100
+f100:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f99
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f100.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f100.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f101
+f101:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f100
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f101.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f101.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f102
+f102:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f101
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f102.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f102.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f103
+f103:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f102
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f103.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f103.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f104
+f104:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f103
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f104.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f104.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f105
+f105:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f104
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f105.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f105.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f106
+f106:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f105
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f106.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f106.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f107
+f107:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f106
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f107.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f107.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f108
+f108:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f107
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f108.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f108.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f109
+f109:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f108
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f109.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f109.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f110
+f110:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f109
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f110.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f110.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f111
+f111:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f110
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f111.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f111.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f112
+f112:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f111
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f112.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f112.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f113
+f113:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f112
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f113.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f113.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f114
+f114:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f113
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f114.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f114.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f115
+f115:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f114
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f115.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f115.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f116
+f116:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f115
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f116.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f116.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f117
+f117:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f116
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f117.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f117.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f118
+f118:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f117
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f118.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f118.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f119
+f119:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f118
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f119.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f119.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f120
+f120:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f119
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f120.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f120.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f121
+f121:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f120
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f121.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f121.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f122
+f122:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f121
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f122.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f122.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f123
+f123:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f122
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f123.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f123.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f124
+f124:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f123
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f124.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f124.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f125
+f125:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f124
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f125.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f125.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f126
+f126:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f125
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f126.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f126.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f127
+f127:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f126
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f127.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f127.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f128
+f128:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f127
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f128.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f128.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f129
+f129:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f128
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f129.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f129.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f130
+f130:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f129
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f130.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f130.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f131
+f131:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f130
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f131.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f131.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f132
+f132:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f131
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f132.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f132.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f133
+f133:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f132
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f133.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f133.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f134
+f134:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f133
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f134.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f134.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f135
+f135:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f134
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f135.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f135.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f136
+f136:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f135
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f136.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f136.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f137
+f137:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f136
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f137.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f137.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f138
+f138:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f137
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f138.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f138.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f139
+f139:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f138
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f139.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f139.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f140
+f140:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f139
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f140.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f140.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f141
+f141:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f140
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f141.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f141.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f142
+f142:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f141
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f142.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f142.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f143
+f143:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f142
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f143.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f143.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f144
+f144:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f143
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f144.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f144.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f145
+f145:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f144
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f145.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f145.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f146
+f146:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f145
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f146.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f146.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f147
+f147:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f146
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f147.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f147.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f148
+f148:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f147
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f148.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f148.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f149
+f149:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f148
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f149.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f149.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f150
+f150:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f149
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f150.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f150.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f151
+f151:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f150
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f151.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f151.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f152
+f152:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f151
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f152.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f152.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f153
+f153:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f152
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f153.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f153.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f154
+f154:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f153
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f154.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f154.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f155
+f155:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f154
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f155.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f155.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f156
+f156:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f155
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f156.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f156.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f157
+f157:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f156
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f157.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f157.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f158
+f158:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f157
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f158.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f158.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f159
+f159:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f158
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f159.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f159.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f160
+f160:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f159
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f160.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f160.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f161
+f161:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f160
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f161.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f161.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f162
+f162:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f161
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f162.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f162.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f163
+f163:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f162
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f163.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f163.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f164
+f164:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f163
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f164.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f164.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f165
+f165:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f164
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f165.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f165.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f166
+f166:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f165
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f166.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f166.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f167
+f167:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f166
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f167.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f167.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f168
+f168:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f167
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f168.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f168.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f169
+f169:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f168
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f169.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f169.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f170
+f170:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f169
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f170.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f170.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f171
+f171:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f170
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f171.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f171.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f172
+f172:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f171
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f172.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f172.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f173
+f173:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f172
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f173.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f173.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f174
+f174:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f173
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f174.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f174.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f175
+f175:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f174
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f175.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f175.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f176
+f176:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f175
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f176.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f176.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f177
+f177:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f176
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f177.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f177.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f178
+f178:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f177
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f178.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f178.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f179
+f179:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f178
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f179.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f179.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f180
+f180:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f179
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f180.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f180.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f181
+f181:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f180
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f181.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f181.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f182
+f182:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f181
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f182.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f182.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f183
+f183:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f182
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f183.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f183.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f184
+f184:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f183
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f184.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f184.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f185
+f185:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f184
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f185.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f185.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f186
+f186:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f185
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f186.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f186.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f187
+f187:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f186
+  mov r10, rax
+  add r10, 5
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f187.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f187.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f188
+f188:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f187
+  mov r10, rax
+  add r10, 6
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f188.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f188.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f189
+f189:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f188
+  mov r10, rax
+  add r10, 7
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f189.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f189.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f190
+f190:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f189
+  mov r10, rax
+  add r10, 8
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f190.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f190.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f191
+f191:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f190
+  mov r10, rax
+  add r10, 9
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f191.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f191.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f192
+f192:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f191
+  mov r10, rax
+  add r10, 10
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f192.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f192.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f193
+f193:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f192
+  mov r10, rax
+  add r10, 11
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f193.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f193.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f194
+f194:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f193
+  mov r10, rax
+  add r10, 12
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f194.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f194.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f195
+f195:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f194
+  mov qword ptr [rbp-8], rax
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f195.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f195.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f196
+f196:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f195
+  mov r10, rax
+  add r10, 1
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f196.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f196.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f197
+f197:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f196
+  mov r10, rax
+  add r10, 2
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f197.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f197.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f198
+f198:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f197
+  mov r10, rax
+  add r10, 3
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f198.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f198.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f199
+f199:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov qword ptr [rbp-24], rdi
+  mov qword ptr [rbp-16], rsi
+  mov r10, qword ptr [rbp-16]
+  mov rax, qword ptr [rbp-24]
+  cqo
+  mov rdi, 7
+  idiv rdi
+  mov r11, rax
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f198
+  mov r10, rax
+  add r10, 4
+  mov qword ptr [rbp-8], r10
+  mov r10, 1000
+  cmp r10, qword ptr [rbp-8]
+  jge .L.f199.4
+  mov r10, qword ptr [rbp-8]
+  add r10, -1000
+  mov qword ptr [rbp-8], r10
+.L.f199.4:
+  mov rax, qword ptr [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  mov r10, 1
+  mov r11, 2
+  mov rdi, r10
+  mov rsi, r11
+  mov rax, 0
+  call f199
+  mov rax, 0
+  mov rsp, rbp
+  pop rbp
+  ret
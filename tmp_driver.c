@@ -0,0 +1,291 @@
+#include <stdio.h>
+long _c0_main(void);
+long _c1_main(void);
+long _c2_main(void);
+long _c3_main(void);
+long _c4_main(void);
+long _c5_main(void);
+long _c6_main(void);
+long _c7_main(void);
+long _c8_main(void);
+long _c9_main(void);
+long _c10_main(void);
+long _c11_main(void);
+long _c12_main(void);
+long _c13_main(void);
+long _c14_main(void);
+long _c15_main(void);
+long _c16_main(void);
+long _c17_main(void);
+long _c18_main(void);
+long _c19_main(void);
+long _c20_main(void);
+long _c21_main(void);
+long _c22_main(void);
+long _c23_main(void);
+long _c24_main(void);
+long _c25_main(void);
+long _c26_main(void);
+long _c27_main(void);
+long _c28_main(void);
+long _c29_main(void);
+long _c30_main(void);
+long _c31_main(void);
+long _c32_main(void);
+long _c33_main(void);
+long _c34_main(void);
+long _c35_main(void);
+long _c36_main(void);
+long _c37_main(void);
+long _c38_main(void);
+long _c39_main(void);
+long _c40_main(void);
+long _c41_main(void);
+long _c42_main(void);
+long _c43_main(void);
+long _c44_main(void);
+long _c45_main(void);
+long _c46_main(void);
+long _c47_main(void);
+long _c48_main(void);
+long _c49_main(void);
+long _c50_main(void);
+long _c51_main(void);
+long _c52_main(void);
+long _c53_main(void);
+long _c54_main(void);
+long _c55_main(void);
+long _c56_main(void);
+long _c57_main(void);
+long _c58_main(void);
+long _c59_main(void);
+long _c60_main(void);
+long _c61_main(void);
+long _c62_main(void);
+long _c63_main(void);
+long _c64_main(void);
+long _c65_main(void);
+long _c66_main(void);
+long _c67_main(void);
+long _c68_main(void);
+long _c69_main(void);
+long _c70_main(void);
+long _c71_main(void);
+long _c72_main(void);
+long _c73_main(void);
+long _c74_main(void);
+long _c75_main(void);
+long _c76_main(void);
+long _c77_main(void);
+long _c78_main(void);
+long _c79_main(void);
+long _c80_main(void);
+long _c81_main(void);
+long _c82_main(void);
+long _c83_main(void);
+long _c84_main(void);
+long _c85_main(void);
+long _c86_main(void);
+long _c87_main(void);
+long _c88_main(void);
+long _c89_main(void);
+long _c90_main(void);
+long _c91_main(void);
+long _c92_main(void);
+long _c93_main(void);
+long _c94_main(void);
+long _c95_main(void);
+long _c96_main(void);
+long _c97_main(void);
+long _c98_main(void);
+long _c99_main(void);
+long _c100_main(void);
+long _c101_main(void);
+long _c102_main(void);
+long _c103_main(void);
+long _c104_main(void);
+long _c105_main(void);
+long _c106_main(void);
+long _c107_main(void);
+long _c108_main(void);
+long _c109_main(void);
+long _c110_main(void);
+long _c111_main(void);
+long _c112_main(void);
+long _c113_main(void);
+long _c114_main(void);
+long _c115_main(void);
+long _c116_main(void);
+long _c117_main(void);
+long _c118_main(void);
+long _c119_main(void);
+long _c120_main(void);
+long _c121_main(void);
+long _c122_main(void);
+long _c123_main(void);
+long _c124_main(void);
+long _c125_main(void);
+long _c126_main(void);
+long _c127_main(void);
+long _c128_main(void);
+long _c129_main(void);
+long _c130_main(void);
+long _c131_main(void);
+long _c132_main(void);
+long _c133_main(void);
+long _c134_main(void);
+long _c135_main(void);
+long _c136_main(void);
+long _c137_main(void);
+long _c138_main(void);
+long _c139_main(void);
+long _c140_main(void);
+long (*tests[])(void) = {
+  _c0_main,
+  _c1_main,
+  _c2_main,
+  _c3_main,
+  _c4_main,
+  _c5_main,
+  _c6_main,
+  _c7_main,
+  _c8_main,
+  _c9_main,
+  _c10_main,
+  _c11_main,
+  _c12_main,
+  _c13_main,
+  _c14_main,
+  _c15_main,
+  _c16_main,
+  _c17_main,
+  _c18_main,
+  _c19_main,
+  _c20_main,
+  _c21_main,
+  _c22_main,
+  _c23_main,
+  _c24_main,
+  _c25_main,
+  _c26_main,
+  _c27_main,
+  _c28_main,
+  _c29_main,
+  _c30_main,
+  _c31_main,
+  _c32_main,
+  _c33_main,
+  _c34_main,
+  _c35_main,
+  _c36_main,
+  _c37_main,
+  _c38_main,
+  _c39_main,
+  _c40_main,
+  _c41_main,
+  _c42_main,
+  _c43_main,
+  _c44_main,
+  _c45_main,
+  _c46_main,
+  _c47_main,
+  _c48_main,
+  _c49_main,
+  _c50_main,
+  _c51_main,
+  _c52_main,
+  _c53_main,
+  _c54_main,
+  _c55_main,
+  _c56_main,
+  _c57_main,
+  _c58_main,
+  _c59_main,
+  _c60_main,
+  _c61_main,
+  _c62_main,
+  _c63_main,
+  _c64_main,
+  _c65_main,
+  _c66_main,
+  _c67_main,
+  _c68_main,
+  _c69_main,
+  _c70_main,
+  _c71_main,
+  _c72_main,
+  _c73_main,
+  _c74_main,
+  _c75_main,
+  _c76_main,
+  _c77_main,
+  _c78_main,
+  _c79_main,
+  _c80_main,
+  _c81_main,
+  _c82_main,
+  _c83_main,
+  _c84_main,
+  _c85_main,
+  _c86_main,
+  _c87_main,
+  _c88_main,
+  _c89_main,
+  _c90_main,
+  _c91_main,
+  _c92_main,
+  _c93_main,
+  _c94_main,
+  _c95_main,
+  _c96_main,
+  _c97_main,
+  _c98_main,
+  _c99_main,
+  _c100_main,
+  _c101_main,
+  _c102_main,
+  _c103_main,
+  _c104_main,
+  _c105_main,
+  _c106_main,
+  _c107_main,
+  _c108_main,
+  _c109_main,
+  _c110_main,
+  _c111_main,
+  _c112_main,
+  _c113_main,
+  _c114_main,
+  _c115_main,
+  _c116_main,
+  _c117_main,
+  _c118_main,
+  _c119_main,
+  _c120_main,
+  _c121_main,
+  _c122_main,
+  _c123_main,
+  _c124_main,
+  _c125_main,
+  _c126_main,
+  _c127_main,
+  _c128_main,
+  _c129_main,
+  _c130_main,
+  _c131_main,
+  _c132_main,
+  _c133_main,
+  _c134_main,
+  _c135_main,
+  _c136_main,
+  _c137_main,
+  _c138_main,
+  _c139_main,
+  _c140_main,
+};
+int main() {
+  for (int i = 0; i < sizeof(tests) / sizeof(*tests); i++) {
+    printf("%d\n", (int)(tests[i]() & 255));
+    fflush(stdout);
+  }
+}
@@ -1,135 +1,206 @@
 #include "litecc.h"
 
-char*  user_input;
-Token* token;
+// Input filename
+_Thread_local char*  current_filename;
+
+// Input string
+_Thread_local char*  user_input;
+
+// Token stream and the index of the current token
+_Thread_local TokenArray tokens;
+_Thread_local int        token;
+
+// If set, errors jump here instead of exiting, so that the driver
+// can go on with other files.
+_Thread_local jmp_buf* error_jmp;
+
+static noreturn void fail(void) {
+  if (error_jmp)
+    longjmp(*error_jmp, 1);
+  exit(1);
+}
 
 // Util function for display token list.
 void dispaly_tokens(void) {
-  Token *cur = token;
-  while(cur->kind != TK_EOF) {
-    switch (cur->kind) {
-      case TK_NUM: 
-        printf("(NUM, %ld) -> ", cur->val); 
+  for (int tok = token; tokens.kind[tok] != TK_EOF; tok++) {
+    switch (tokens.kind[tok]) {
+      case TK_NUM:
+        printf("(NUM, %ld) -> ", tokens.val[tok]);
         break;
       case TK_RESERVED:
-        char* sval = (char *)calloc(10, sizeof(char));
-        strncpy(sval, cur->str, cur->len);
-        printf("(RES, %s) -> ", sval);
+        printf("(RES, %.*s) -> ", tokens.len[tok], tok_str(tok));
+        break;
+      case TK_IDENT:
+        printf("(IDENT, %.*s) -> ", tokens.len[tok], tok_str(tok));
         break;
     }
-    cur = cur->next;
   }
   printf("(EOF, NULL)\n");
 }
 
 // Reports an error and exit.
-void error(char *fmt, ...) {
+noreturn void error(char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
+  flockfile(stderr);
   vfprintf(stderr, fmt, ap);
   fprintf(stderr, "\n");
-  exit(1);
+  funlockfile(stderr);
+  va_end(ap);
+  fail();
 }
 
-// Reports an error location and exit.
+// Prints an error message in the following format.
+//
+// foo.c:10: x = y + 1;
+//               ^ <error message here>
 static void verror_at(char* loc, char* fmt, va_list ap) {
-  int pos = loc - user_input;
-  fprintf(stderr, "%s\n", user_input);
-  fprintf(stderr, "%*s", pos, " ");
+  // Find a line containing `loc`.
+  char* line = loc;
+  while (user_input < line && line[-1] != '\n')
+    line--;
+
+  char* end = loc;
+  while (*end && *end != '\n')
+    end++;
+
+  // Get a line number.
+  int line_num = 1;
+  for (char* p = user_input; p < line; p++)
+    if (*p == '\n')
+      line_num++;
+
+  // Print out the line. Keep the message together when several
+  // files are being compiled.
+  flockfile(stderr);
+  int indent = fprintf(stderr, "%s:%d: ", current_filename, line_num);
+  fprintf(stderr, "%.*s\n", (int)(end - line), line);
+
+  // Show the error message.
+  int pos = loc - line + indent;
+  fprintf(stderr, "%*s", pos, "");
   fprintf(stderr, "^ ");
   vfprintf(stderr, fmt, ap);
   fprintf(stderr, "\n");
-  exit(1);
+  funlockfile(stderr);
 }
 
 // Reports an error location and exit.
-void error_at(char* loc, char* fmt, ...) {
+noreturn void error_at(char* loc, char* fmt, ...) {
   va_list args;
   va_start(args, fmt);
   verror_at(loc, fmt, args);
+  va_end(args);
+  fail();
 }
 
 // Reports an error location and exit.
-void error_tok(Token* tok, char* fmt, ...) {
+noreturn void error_tok(int tok, char* fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->str, fmt, ap);
+  verror_at(tok_str(tok), fmt, ap);
+  va_end(ap);
+  fail();
 }
 
-// Consumes the current token if it matches `op`.
-Token* consume(char *op) {
-  if (token->kind != TK_RESERVED ||
-      token->len != strlen(op) || 
-      strncmp(token->str, op, token->len)) {
-    return NULL;
-  }
-  Token* t = token;
-  token = token->next;
-  return t;
+// Returns the source text of a given token.
+char* tok_str(int tok) {
+  return user_input + tokens.loc[tok];
 }
 
-// Returns true if the current token matches a given string.
-Token* peek(char* s) {
-  if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-      strncmp(token->str, s, token->len))
-    return NULL;
+// Spellings of keywords and punctuators, for diagnostics.
+static char* token_names[] = {
+  [TOK_RETURN] = "return", [TOK_IF] = "if", [TOK_ELSE] = "else",
+  [TOK_WHILE] = "while", [TOK_FOR] = "for", [TOK_INT] = "int",
+  [TOK_SIZEOF] = "sizeof",
+  [TOK_EQ] = "==", [TOK_NE] = "!=", [TOK_LE] = "<=", [TOK_GE] = ">=",
+  [TOK_LT] = "<", [TOK_GT] = ">", [TOK_ASSIGN] = "=", [TOK_PLUS] = "+",
+  [TOK_MINUS] = "-", [TOK_STAR] = "*", [TOK_SLASH] = "/", [TOK_AMP] = "&",
+  [TOK_LPAREN] = "(", [TOK_RPAREN] = ")", [TOK_LBRACE] = "{",
+  [TOK_RBRACE] = "}", [TOK_LBRACKET] = "[", [TOK_RBRACKET] = "]",
+  [TOK_SEMI] = ";", [TOK_COMMA] = ",",
+};
+
+// Consumes the current token if it is the keyword or punctuator
+// `id`. Returns the index of the consumed token, or 0 if it does not
+// match. Only TK_RESERVED tokens have a nonzero ID, so comparing the
+// ID alone is enough.
+int consume(TokenId id) {
+  if (tokens.id[token] != id)
+    return 0;
+  return token++;
+}
+
+// Returns the current token if it is the keyword or punctuator `id`.
+int peek(TokenId id) {
+  if (tokens.id[token] != id)
+    return 0;
   return token;
 }
 
 // Consume the current token if it is an identifier.
-Token* consume_ident(void) {
-  if (token->kind != TK_IDENT) {
-    return NULL;
-  }
-  Token* t = token;
-  token = token->next;
-  return t;
+int consume_ident(void) {
+  if (tokens.kind[token] != TK_IDENT)
+    return 0;
+  return token++;
 }
 
-// Ensure that the current token is a given string
-void expect(char *s) {
-  if (!peek(s))
-    error_tok(token, "expected \"%s\"", s);
-  token = token->next;
+// Ensure that the current token is the keyword or punctuator `id`.
+void expect(TokenId id) {
+  if (tokens.id[token] != id)
+    error_tok(token, "expected \"%s\"", token_names[id]);
+  token++;
 }
 
 // Ensure that the current token is TK_NUM.
 long expect_number(void) {
-  if (token->kind != TK_NUM) {
+  if (tokens.kind[token] != TK_NUM) {
     error_tok(token, "expected number.");
   }
-  long val = token->val;
-  token = token->next;
-  return val;
+  return tokens.val[token++];
 }
 
-// Ensure that the current token is TK_IDNET.
-char *expect_ident(void) {
-  if (token->kind != TK_IDENT) {
+// Ensure that the current token is TK_IDNET. Returns its symbol ID.
+int expect_ident(void) {
+  if (tokens.kind[token] != TK_IDENT) {
     error_tok(token, "expected an identifier");
   }
-  char* s = strndup(token->str, token->len);
-  token = token->next;
-  return s;
+  return tokens.val[token++];
 }
 
 // Check is or not reach to file end.
 bool at_eof() {
-  return token->kind == TK_EOF;
+  return tokens.kind[token] == TK_EOF;
 }
 
-// Create a new token and add it as the next token of `cur`.
-static Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
-  tok->kind = kind;
-  tok->str = str;
-  tok->len = len;
-  cur->next = tok;
-  return tok;
+static void* grow_array(void* p, int old_cap, int cap, size_t size) {
+  return region_realloc(MEM_TOKENS, p, old_cap * size, cap * size);
 }
 
-static bool startwith(char *p, const char *t) {
-  return strncmp(p, t, strlen(t)) == 0;
+// Grows the token arrays geometrically, so that tokenizing n tokens
+// takes O(log n) allocations.
+static void grow_tokens(void) {
+  int old = tokens.cap;
+  int cap = old ? old * 2 : 1024;
+  tokens.kind = grow_array(tokens.kind, old, cap, sizeof(*tokens.kind));
+  tokens.id   = grow_array(tokens.id,   old, cap, sizeof(*tokens.id));
+  tokens.loc  = grow_array(tokens.loc,  old, cap, sizeof(*tokens.loc));
+  tokens.len  = grow_array(tokens.len,  old, cap, sizeof(*tokens.len));
+  tokens.val  = grow_array(tokens.val,  old, cap, sizeof(*tokens.val));
+  tokens.cap = cap;
+}
+
+// Append a new token and return its index.
+static int new_token(TokenKind kind, TokenId id, char *str, int len) {
+  if (tokens.nr == tokens.cap)
+    grow_tokens();
+  int tok = tokens.nr++;
+  tokens.kind[tok] = kind;
+  tokens.id[tok] = id;
+  tokens.loc[tok] = str - user_input;
+  tokens.len[tok] = len;
+  tokens.val[tok] = 0;
+  return tok;
 }
 
 static bool is_alpha(char c) {
@@ -140,34 +211,80 @@ static bool is_alnum(char c) {
   return is_alpha(c) || ('0' <= c && c <= '9');
 }
 
-static char *starts_with_reserved(char *p) {
-  // Keyword
-  static char* kw[] = {"return", "if", "else", "while", "for", "int", "sizeof"};
+static bool equal(char* p, int len, char* kw, int kwlen) {
+  return len == kwlen && !memcmp(p, kw, len);
+}
 
-  for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
-    int len = strlen(kw[i]);
-    if (startwith(p, kw[i]) && !is_alnum(p[len])) {
-      return kw[i];
-    }
+// Returns the keyword ID of identifier `p` of length `len`, or
+// TOK_NONE if it is not a keyword. Dispatching on the first
+// character and the length leaves at most one candidate to compare.
+static TokenId keyword_id(char* p, int len) {
+  switch (p[0]) {
+    case 'e':
+      if (equal(p, len, "else", 4)) return TOK_ELSE;
+      break;
+    case 'f':
+      if (equal(p, len, "for", 3)) return TOK_FOR;
+      break;
+    case 'i':
+      if (equal(p, len, "if", 2)) return TOK_IF;
+      if (equal(p, len, "int", 3)) return TOK_INT;
+      break;
+    case 'r':
+      if (equal(p, len, "return", 6)) return TOK_RETURN;
+      break;
+    case 's':
+      if (equal(p, len, "sizeof", 6)) return TOK_SIZEOF;
+      break;
+    case 'w':
+      if (equal(p, len, "while", 5)) return TOK_WHILE;
+      break;
   }
+  return TOK_NONE;
+}
 
-  // Multi-letter punctuator
-  static char* ops[] = {"==", "!=", "<=", ">="};
+// Single-letter punctuators, indexed by their character.
+static const unsigned char punct1[256] = {
+  ['+'] = TOK_PLUS,   ['-'] = TOK_MINUS,  ['*'] = TOK_STAR,
+  ['/'] = TOK_SLASH,  ['&'] = TOK_AMP,    ['='] = TOK_ASSIGN,
+  ['<'] = TOK_LT,     ['>'] = TOK_GT,     ['('] = TOK_LPAREN,
+  [')'] = TOK_RPAREN, ['{'] = TOK_LBRACE, ['}'] = TOK_RBRACE,
+  ['['] = TOK_LBRACKET, [']'] = TOK_RBRACKET,
+  [';'] = TOK_SEMI,   [','] = TOK_COMMA,
+};
 
-  for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++) {
-    if (startwith(p, ops[i])) {
-      return ops[i];
-    }
-  }
+// Two-letter punctuators of the form "X=", indexed by X.
+static const unsigned char punct2[256] = {
+  ['='] = TOK_EQ, ['!'] = TOK_NE, ['<'] = TOK_LE, ['>'] = TOK_GE,
+};
 
-  return NULL;
+// Reads a punctuator at `p` and returns its length, or 0 if there is
+// none. Its ID is stored to `id`.
+static int read_punct(char* p, TokenId* id) {
+  unsigned char c = *p;
+  if (p[1] == '=' && punct2[c]) {
+    *id = punct2[c];
+    return 2;
+  }
+  if (punct1[c]) {
+    *id = punct1[c];
+    return 1;
+  }
+  if (ispunct(c)) {
+    *id = TOK_PUNCT;
+    return 1;
+  }
+  return 0;
 }
 
 // Scanner: tokenize source code to independt token.
-Token *tokenize(void) {
+// Returns the index of the first token.
+int tokenize(void) {
   char *p = user_input;
-  Token head = {};
-  Token *cur = &head;
+  tokens = (TokenArray){};
+
+  // Index 0 is never a real token, so that 0 can mean "no token".
+  new_token(TK_EOF, TOK_NONE, p, 0);
 
   while (*p) {
     // Skip whitespace characters.
@@ -176,36 +293,37 @@ Token *tokenize(void) {
       continue;
     }
     
-    // Keywords or multi-letter punctuators
-    char *kw = starts_with_reserved(p);
-    if (kw != NULL) {
-      int len = strlen(kw);
-      cur = new_token(TK_RESERVED, cur, p, len);
-      p += len;
-      continue;
-    }
-    
-    // Identifier
+    // Identifier or keyword. Identifiers are hashed with the same
+    // function as hash_string() as they are scanned, and interned.
     if (is_alpha(*p)) {
-      char *q = p++;
-      while (is_alnum(*p))
-        ++p;
-      cur = new_token(TK_IDENT, cur, q, p - q);
+      char *q = p;
+      uint32_t hash = 2166136261u;
+      do {
+        hash = (hash ^ (unsigned char)*p++) * 16777619u;
+      } while (is_alnum(*p));
+
+      TokenId id = keyword_id(q, p - q);
+      int tok = new_token(id ? TK_RESERVED : TK_IDENT, id, q, p - q);
+      if (!id)
+        tokens.val[tok] = intern_hashed(q, p - q, hash);
       continue;
     }
     
-    // Single-letter punctuators
-    if (ispunct(*p)) {
-      cur = new_token(TK_RESERVED, cur, p++, 1);
+    // Punctuators
+    TokenId id;
+    int len = read_punct(p, &id);
+    if (len) {
+      new_token(TK_RESERVED, id, p, len);
+      p += len;
       continue;
     }
     
     // Integer literal
     if (isdigit(*p)) {
-      cur = new_token(TK_NUM, cur, p, 0);
       char *q = p;
-      cur->val = strtol(p, &p, 10);
-      cur->len = p - q;
+      long val = strtol(p, &p, 10);
+      int tok = new_token(TK_NUM, TOK_NONE, q, p - q);
+      tokens.val[tok] = val;
       continue;
     }
     
@@ -213,6 +331,6 @@ Token *tokenize(void) {
     error_at(p, "invalid token");
   }
   
-  cur = new_token(TK_EOF, cur, p, 0);
-  return head.next;
-}
\ No newline at end of file
+  new_token(TK_EOF, TOK_NONE, p, 0);
+  return 1;
+}
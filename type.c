@@ -6,40 +6,76 @@ bool is_integer(Type* ty) {
   return ty->kind == TY_INT;
 }
 
-Type* pointer_to(Type* base) {
-  Type *ty = calloc(1, sizeof(Type));
-  ty->base = base;
-  ty->size = 8;
-  ty->kind = TY_PTR;
-  return ty;
+// Types are hash-consed: pointer_to() and array_of() return the same
+// object for the same base type and length, so each type is
+// allocated once and two types are equal only if they are the same
+// object. The table is open-addressed with linear probing. Like the
+// types, it belongs to the compilation: each thread has its own, and
+// reset_types() starts a new one.
+static _Thread_local Type** table;
+static _Thread_local int    table_cap;
+static _Thread_local int    table_used;
+
+void reset_types(void) {
+  table = NULL;
+  table_cap = table_used = 0;
 }
 
-Type* array_of(Type* base, int len) {
-  Type *ty = calloc(1, sizeof(Type));
-  ty->kind = TY_ARRAY;
-  ty->size = base->size * len;
+static uint32_t hash_type(TypeKind kind, Type* base, int len) {
+  uint64_t h = (uintptr_t)base ^ ((uint64_t)kind << 32 | (uint32_t)len);
+  return (h * 0x9e3779b97f4a7c15ull) >> 32;
+}
+
+static void insert(Type* ty) {
+  uint32_t i = hash_type(ty->kind, ty->base, ty->array_len) & (table_cap - 1);
+  while (table[i])
+    i = (i + 1) & (table_cap - 1);
+  table[i] = ty;
+}
+
+static void rehash(void) {
+  Type** old = table;
+  int old_cap = table_cap;
+  table_cap = table_cap ? table_cap * 2 : 256;
+  table = region_alloc(MEM_TYPES, table_cap * sizeof(Type*));
+  for (int i = 0; i < old_cap; i++)
+    if (old[i])
+      insert(old[i]);
+}
+
+static Type* intern_type(TypeKind kind, Type* base, int len, int size) {
+  if (table_used * 2 >= table_cap)
+    rehash();
+
+  uint32_t i = hash_type(kind, base, len) & (table_cap - 1);
+  for (Type* ty; (ty = table[i]) != NULL; i = (i + 1) & (table_cap - 1)) {
+    if (ty->kind == kind && ty->base == base && ty->array_len == len)
+      return ty;
+  }
+
+  Type* ty = region_alloc(MEM_TYPES, sizeof(Type));
+  ty->kind = kind;
+  ty->size = size;
   ty->base = base;
   ty->array_len = len;
+  table[i] = ty;
+  table_used++;
+  stats.types++;
   return ty;
 }
 
-void add_type(Node* node) {
-  if (!node || node->ty)
-    return;
-  
-  add_type(node->lhs);
-  add_type(node->rhs);
-  add_type(node->cond);
-  add_type(node->then);
-  add_type(node->els);
-  add_type(node->init);
-  add_type(node->inc);
+Type* pointer_to(Type* base) {
+  return intern_type(TY_PTR, base, 0, 8);
+}
 
-  for (Node *n = node->block; n != NULL; n = n->next)
-    add_type(n);
-  for (Node *n = node->args; n != NULL; n = n->next)
-    add_type(n);
+Type* array_of(Type* base, int len) {
+  return intern_type(TY_ARRAY, base, len, base->size * len);
+}
 
+// Sets the type of `node` from the types of its operands, which must
+// already be set. The parser calls this on every node it builds, so
+// a tree is typed bottom-up as it is constructed and never walked.
+void add_type(Node* node) {
   switch (node->kind) {
     case ND_ADD:
     case ND_SUB:
@@ -74,4 +110,5 @@ void add_type(Node* node) {
       node->ty = node->lhs->ty->base;
       return;
   }
-}
\ No newline at end of file
+}
+
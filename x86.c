@@ -0,0 +1,155 @@
+#include "litecc.h"
+
+// x86-64 instruction lists.
+//
+// The code generator does not produce text directly. It appends
+// structured instructions to an InstList, which later passes such
+// as the peephole optimizer can inspect and rewrite before the list
+// is printed as Intel-syntax assembly.
+
+static char* reg_names[] = {
+  "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "rip",
+};
+
+static char* inst_names[] = {
+  [I_NOP] = "nop", [I_MOV] = "mov", [I_LEA] = "lea", [I_ADD] = "add",
+  [I_SUB] = "sub", [I_IMUL] = "imul", [I_IDIV] = "idiv", [I_CQO] = "cqo",
+  [I_NEG] = "neg", [I_AND] = "and", [I_CMP] = "cmp", [I_SETCC] = "set",
+  [I_MOVZB] = "movzx", [I_PUSH] = "push", [I_POP] = "pop",
+  [I_JMP] = "jmp", [I_JCC] = "j", [I_CALL] = "call", [I_RET] = "ret",
+};
+
+static char* cc_names[] = {
+  [CC_E] = "e", [CC_NE] = "ne", [CC_L] = "l",
+  [CC_LE] = "le", [CC_G] = "g", [CC_GE] = "ge",
+};
+
+Operand op_reg(Reg reg) {
+  return (Operand){ .kind = OPR_REG, .reg = reg };
+}
+
+Operand op_imm(long val) {
+  return (Operand){ .kind = OPR_IMM, .val = val };
+}
+
+// [base+disp]
+Operand op_mem(Reg base, long disp) {
+  return (Operand){ .kind = OPR_MEM, .reg = base, .val = disp };
+}
+
+// [rip+sym+disp]
+Operand op_rip(int sym, long disp) {
+  return (Operand){ .kind = OPR_MEM, .reg = RIP, .sym = sym, .val = disp };
+}
+
+Operand op_label(int label) {
+  return (Operand){ .kind = OPR_LABEL, .val = label };
+}
+
+Operand op_sym(int sym) {
+  return (Operand){ .kind = OPR_SYM, .sym = sym };
+}
+
+Inst* inst_add(InstList* list, InstKind kind, Operand a, Operand b) {
+  if (list->len == list->cap) {
+    list->cap = list->cap ? list->cap * 2 : 256;
+    list->data = realloc(list->data, list->cap * sizeof(Inst));
+  }
+  Inst* in = &list->data[list->len++];
+  *in = (Inst){ .kind = kind, .a = a, .b = b };
+  return in;
+}
+
+bool is_imm32(long val) {
+  return val == (int)val;
+}
+
+CondCode negate_cc(CondCode cc) {
+  switch (cc) {
+    case CC_E:  return CC_NE;
+    case CC_NE: return CC_E;
+    case CC_L:  return CC_GE;
+    case CC_LE: return CC_G;
+    case CC_G:  return CC_LE;
+    case CC_GE: return CC_L;
+  }
+  error("internal error: unknown condition code");
+}
+
+// Labels are numbered within a function, so they are qualified with
+// the function's name: .L.<fn>.<n>.
+static void print_label(Buf* buf, int fn, long label) {
+  buf_printf(buf, ".L.%s.%ld", sym_name(fn), label);
+}
+
+static void print_operand(Buf* buf, int fn, Operand* op, bool ptr) {
+  switch (op->kind) {
+    case OPR_REG:
+      buf_puts(buf, reg_names[op->reg]);
+      return;
+    case OPR_IMM:
+      buf_putint(buf, op->val);
+      return;
+    case OPR_MEM:
+      if (ptr)
+        buf_puts(buf, "qword ptr ");
+      buf_putc(buf, '[');
+      buf_puts(buf, reg_names[op->reg]);
+      if (op->reg == RIP) {
+        buf_putc(buf, '+');
+        buf_puts(buf, sym_name(op->sym));
+      }
+      if (op->val > 0)
+        buf_putc(buf, '+');
+      if (op->val)
+        buf_putint(buf, op->val);
+      buf_putc(buf, ']');
+      return;
+    case OPR_LABEL:
+      print_label(buf, fn, op->val);
+      return;
+    case OPR_SYM:
+      buf_puts(buf, sym_name(op->sym));
+      return;
+  }
+}
+
+// Prints the instruction list of function `fn` as Intel-syntax
+// assembly.
+void print_insts(Buf* buf, int fn, InstList* list) {
+  for (int i = 0; i < list->len; i++) {
+    Inst* in = &list->data[i];
+
+    switch (in->kind) {
+      case I_NOP:
+        continue;
+      case I_LABEL:
+        print_label(buf, fn, in->a.val);
+        buf_puts(buf, ":\n");
+        continue;
+      case I_SETCC:
+        buf_printf(buf, "  set%s al\n", cc_names[in->cc]);
+        continue;
+      case I_MOVZB:
+        buf_printf(buf, "  movzx %s, al\n", reg_names[in->a.reg]);
+        continue;
+      case I_JCC:
+        buf_printf(buf, "  j%s ", cc_names[in->cc]);
+        print_operand(buf, fn, &in->a, false);
+        buf_putc(buf, '\n');
+        continue;
+    }
+
+    buf_puts(buf, "  ");
+    buf_puts(buf, inst_names[in->kind]);
+
+    bool ptr = in->kind != I_LEA;
+    Operand* ops[] = { &in->a, &in->b, &in->c };
+    for (int j = 0; j < 3 && ops[j]->kind != OPR_NONE; j++) {
+      buf_puts(buf, j ? ", " : " ");
+      print_operand(buf, fn, ops[j], ptr);
+    }
+    buf_putc(buf, '\n');
+  }
+}